@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+
+#include "arena.h"
+#include "keypair.h"
+
+// Host counterpart of BENCH-KEYGEN, running the same seed corpus through
+// keypair.c with the mbedtls software bignum backend, along with the
+// mbedtls_rsa_gen_key prime search (the baseline) for comparison. The DS
+// encrypt phase needs the device, so is not included.
+//
+// The keys are deterministic, so the pubkey.N prefixes must match those
+// reported by BENCH-KEYGEN on a device. With --check, only the seed INDEX
+// is generated, twice, within the GEN-KEY arena (see KEYPAIR_ARENA_SIZE);
+// the run fails unless both moduli match and the arena never overflowed.
+// The software bignum allocates differently from the hardware MPI, so the
+// device's high-water (from BENCH-KEYGEN) is the one to size the arena by.
+//
+// Usage: keygen-bench [ --check INDEX ]
+
+// Generates the key for the corpus seed index within an arena (as GEN-KEY
+// does), writing its modulus
+static int generateModulus(uint8_t index, uint8_t *pubkeyN, size_t length,
+  ArenaStats *stats) {
+
+    uint8_t seed[KEYPAIR_BENCH_SEED_LENGTH];
+    keypair_benchSeed(index, seed);
+
+    int ret = arena_begin(KEYPAIR_ARENA_SIZE);
+    if (ret) { return ret; }
+
+    KeyPair keypair = { 0 };
+    ret = keypair_generateSeeded(&keypair, KEY_SIZE, seed, sizeof(seed), false, NULL);
+
+    if (ret == 0 && mbedtls_mpi_bitlen(&keypair.N) != KEY_SIZE) { ret = -1; }
+    if (ret == 0) { ret = mbedtls_mpi_write_binary(&keypair.N, pubkeyN, length); }
+
+    esp_ds_p_data_t params = { 0 };
+    if (ret == 0) { ret = keypair_getParams(&keypair, &params); }
+
+    keypair_free(&keypair);
+    arena_end(stats);
+
+    return ret;
+}
+
+static int check(uint8_t index) {
+    uint8_t first[KEY_SIZE / 8], second[KEY_SIZE / 8];
+    ArenaStats stats[2] = { 0 };
+
+    int ret = generateModulus(index, first, sizeof(first), &stats[0]);
+    if (ret == 0) { ret = generateModulus(index, second, sizeof(second), &stats[1]); }
+    if (ret) {
+        printf("! failed to generate RSA key (code=%d)\n", ret);
+        return 1;
+    }
+
+    size_t highWater = stats[0].highWater;
+    if (stats[1].highWater > highWater) { highWater = stats[1].highWater; }
+    printf("<check.arena.highWater=%zu\n", highWater);
+    printf("<check.arena.size=%d\n", KEYPAIR_ARENA_SIZE);
+
+    if (stats[0].fallbacks || stats[1].fallbacks) {
+        printf("! KEYPAIR_ARENA_SIZE overflowed (%zu fallbacks)\n",
+          stats[0].fallbacks + stats[1].fallbacks);
+        return 1;
+    }
+
+    printf("<check.%d.pubkey.N=", index);
+    for (int j = 0; j < 8; j++) { printf("%02x", first[j]); }
+    printf(" (8 bytes)\n");
+
+    if (memcmp(first, second, sizeof(first))) {
+        printf("! seed %d is not deterministic\n", index);
+        return 1;
+    }
+
+    printf("<check.deterministic=1\n");
+
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && strcmp(argv[1], "--check") == 0) {
+        int index = atoi(argv[2]);
+        if (index >= 0 && index < KEYPAIR_BENCH_SEEDS) { return check(index); }
+    }
+
+    if (argc != 1) {
+        fprintf(stderr, "Usage: keygen-bench [ --check INDEX ]\n");
+        return 1;
+    }
+
+    uint64_t total[4] = { 0 };
+    uint64_t baselineTotal = 0;
+
+    for (uint8_t i = 0; i < KEYPAIR_BENCH_SEEDS; i++) {
+        uint8_t seed[KEYPAIR_BENCH_SEED_LENGTH];
+        keypair_benchSeed(i, seed);
+
+        KeyPair keypair = { 0 };
+        KeyPairTiming timing = { 0 };
+
+        int ret = keypair_generateSeeded(&keypair, KEY_SIZE, seed, sizeof(seed), true,
+          &timing);
+        if (ret) {
+            printf("! failed to generate RSA key (code=%d)\n", ret);
+            return 1;
+        }
+        keypair_free(&keypair);
+
+        uint32_t baselineUs = timing.searchUs;
+        baselineTotal += baselineUs;
+
+        ret = keypair_generateSeeded(&keypair, KEY_SIZE, seed, sizeof(seed), false,
+          &timing);
+        if (ret) {
+            printf("! failed to generate RSA key (code=%d)\n", ret);
+            return 1;
+        }
+
+        uint8_t pubkeyN[KEY_SIZE / 8];
+        mbedtls_mpi_write_binary(&keypair.N, pubkeyN, sizeof(pubkeyN));
+
+        int64_t t0 = esp_timer_get_time();
+
+        esp_ds_p_data_t params = { 0 };
+        ret = keypair_getParams(&keypair, &params);
+        if (ret) {
+            printf("! failed to derive params (code=%d)\n", ret);
+            return 1;
+        }
+
+        int64_t t1 = esp_timer_get_time();
+
+        keypair_free(&keypair);
+
+        uint32_t timings[4] = {
+            timing.seedUs, timing.searchUs, timing.exportUs, (uint32_t)(t1 - t0)
+        };
+        for (int j = 0; j < 4; j++) { total[j] += timings[j]; }
+
+        printf("? bench %d: baseline=%uus seed=%uus search=%uus export=%uus params=%uus\n",
+          i, baselineUs, timings[0], timings[1], timings[2], timings[3]);
+
+        printf("<bench.%d.pubkey.N=", i);
+        for (int j = 0; j < 8; j++) { printf("%02x", pubkeyN[j]); }
+        printf(" (8 bytes)\n");
+    }
+
+    printf("<bench.seeds=%d\n", KEYPAIR_BENCH_SEEDS);
+    printf("<bench.baseline=%llu\n", (unsigned long long)(baselineTotal / KEYPAIR_BENCH_SEEDS));
+    printf("<bench.seed=%llu\n", (unsigned long long)(total[0] / KEYPAIR_BENCH_SEEDS));
+    printf("<bench.search=%llu\n", (unsigned long long)(total[1] / KEYPAIR_BENCH_SEEDS));
+    printf("<bench.export=%llu\n", (unsigned long long)(total[2] / KEYPAIR_BENCH_SEEDS));
+    printf("<bench.params=%llu\n", (unsigned long long)(total[3] / KEYPAIR_BENCH_SEEDS));
+
+    return 0;
+}
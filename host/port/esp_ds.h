@@ -0,0 +1,27 @@
+#ifndef __ESP_DS_H__
+#define __ESP_DS_H__
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// The ESP32-C3 values; the DS peripheral itself is not available
+#define ESP_DS_SIGNATURE_MAX_BIT_LEN   (3072)
+
+typedef struct {
+    uint32_t Y[ESP_DS_SIGNATURE_MAX_BIT_LEN / 32];
+    uint32_t M[ESP_DS_SIGNATURE_MAX_BIT_LEN / 32];
+    uint32_t Rb[ESP_DS_SIGNATURE_MAX_BIT_LEN / 32];
+    uint32_t M_prime;
+    uint32_t length;
+} esp_ds_p_data_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ESP_DS_H__ */
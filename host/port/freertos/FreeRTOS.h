@@ -0,0 +1,49 @@
+#ifndef __FREERTOS_H__
+#define __FREERTOS_H__
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdPASS                (1)
+#define pdFAIL                (0)
+#define pdTRUE                (1)
+#define pdFALSE               (0)
+
+#define portMAX_DELAY         ((TickType_t)0xffffffff)
+#define portTICK_PERIOD_MS    (1)
+
+#define tskIDLE_PRIORITY      (0)
+
+#define pdMS_TO_TICKS(ms)     ((TickType_t)(ms) / portTICK_PERIOD_MS)
+
+// Waits on cond (with mutex held) for up to ticks; non-zero on timeout
+static inline int _hostWait(pthread_cond_t *cond, pthread_mutex_t *mutex,
+  TickType_t ticks) {
+
+    if (ticks == portMAX_DELAY) { return pthread_cond_wait(cond, mutex); }
+
+    struct timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    uint64_t ns = until.tv_nsec + (uint64_t)ticks * portTICK_PERIOD_MS * 1000000;
+    until.tv_sec += ns / 1000000000;
+    until.tv_nsec = ns % 1000000000;
+
+    return pthread_cond_timedwait(cond, mutex, &until);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FREERTOS_H__ */
@@ -0,0 +1,78 @@
+#ifndef __SEMPHR_H__
+#define __SEMPHR_H__
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// Mutexes and binary semaphores; a mutex take always waits forever
+typedef struct HostSemaphore {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool binary;
+    bool given;
+} HostSemaphore;
+
+typedef HostSemaphore* SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t _hostSemaphoreCreate(bool binary) {
+    SemaphoreHandle_t sem = calloc(1, sizeof(HostSemaphore));
+    if (sem == NULL) { return NULL; }
+    pthread_mutex_init(&sem->mutex, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->binary = binary;
+    return sem;
+}
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return _hostSemaphoreCreate(false);
+}
+
+// Created empty, as on FreeRTOS
+static inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return _hostSemaphoreCreate(true);
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    if (!sem->binary) {
+        return (pthread_mutex_lock(&sem->mutex) == 0) ? pdTRUE: pdFALSE;
+    }
+
+    pthread_mutex_lock(&sem->mutex);
+    while (!sem->given) {
+        if (_hostWait(&sem->cond, &sem->mutex, ticks)) { break; }
+    }
+    bool taken = sem->given;
+    sem->given = false;
+    pthread_mutex_unlock(&sem->mutex);
+
+    return taken ? pdTRUE: pdFALSE;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (!sem->binary) {
+        return (pthread_mutex_unlock(&sem->mutex) == 0) ? pdTRUE: pdFALSE;
+    }
+
+    pthread_mutex_lock(&sem->mutex);
+    bool given = !sem->given;
+    sem->given = true;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->mutex);
+
+    return given ? pdTRUE: pdFALSE;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __SEMPHR_H__ */
@@ -0,0 +1,101 @@
+#ifndef __TASK_H__
+#define __TASK_H__
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "FreeRTOS.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// Tasks are detached threads; priorities and stack sizes are ignored.
+// Notifications may only be taken by tasks created by xTaskCreate, in the
+// same file (the current task is per translation unit), and a task's state
+// is never freed, since its handle may outlive it.
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct HostTask {
+    TaskFunction_t func;
+    void *arg;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t notified;
+} HostTask;
+
+static __thread HostTask *_hostTaskCurrent = NULL;
+
+static inline void* _hostTaskRun(void *arg) {
+    _hostTaskCurrent = arg;
+    _hostTaskCurrent->func(_hostTaskCurrent->arg);
+    return NULL;
+}
+
+static inline BaseType_t xTaskCreate(TaskFunction_t func, const char *name,
+  uint32_t stackDepth, void *arg, UBaseType_t priority, TaskHandle_t *handle) {
+
+    HostTask *task = calloc(1, sizeof(HostTask));
+    if (task == NULL) { return pdFAIL; }
+    task->func = func;
+    task->arg = arg;
+    pthread_mutex_init(&task->mutex, NULL);
+    pthread_cond_init(&task->cond, NULL);
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, _hostTaskRun, task)) {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (handle) { *handle = task; }
+
+    return pdPASS;
+}
+
+static inline void xTaskNotifyGive(TaskHandle_t handle) {
+    HostTask *task = handle;
+    pthread_mutex_lock(&task->mutex);
+    task->notified++;
+    pthread_cond_signal(&task->cond);
+    pthread_mutex_unlock(&task->mutex);
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    HostTask *task = _hostTaskCurrent;
+    pthread_mutex_lock(&task->mutex);
+    while (task->notified == 0) {
+        if (_hostWait(&task->cond, &task->mutex, ticks)) { break; }
+    }
+    uint32_t notified = task->notified;
+    if (notified) { task->notified = clear ? 0: notified - 1; }
+    pthread_mutex_unlock(&task->mutex);
+
+    return notified;
+}
+
+// Identifies the calling thread; only comparable with other results of
+// this (not with handles from xTaskCreate)
+static inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return (TaskHandle_t)(uintptr_t)pthread_self();
+}
+
+static inline void vTaskDelay(TickType_t ticks) {
+    usleep(ticks * portTICK_PERIOD_MS * 1000);
+}
+
+// Only the calling task may be deleted
+static inline void vTaskDelete(TaskHandle_t task) {
+    pthread_exit(NULL);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __TASK_H__ */
@@ -0,0 +1,9 @@
+#ifndef __MBEDTLS_CONFIG_HOST_H__
+#define __MBEDTLS_CONFIG_HOST_H__
+
+// Additions to the default mbedtls config for the host builds (passed as
+// MBEDTLS_USER_CONFIG_FILE), matching the ESP-IDF options the firmware
+// relies on: arena.c swaps the allocator with mbedtls_platform_set_calloc_free
+#define MBEDTLS_PLATFORM_MEMORY
+
+#endif /* __MBEDTLS_CONFIG_HOST_H__ */
@@ -0,0 +1,7 @@
+#ifndef __SDKCONFIG_H__
+#define __SDKCONFIG_H__
+
+// The host builds are only used for testing and benchmarking
+#define CONFIG_PIXIE_KEYGEN_BENCHMARK   1
+
+#endif /* __SDKCONFIG_H__ */
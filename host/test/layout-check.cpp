@@ -0,0 +1,6 @@
+// Builds the proof layout headers as C++ (their layout checks are
+// compile-time), as host tools include them
+#include "attest.h"
+#include "delegate.h"
+
+static_assert(ATTEST_COMPACT_KEYID_OFFSET == ATTEST_PUBKEYN_OFFSET, "compact key ID moved");
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+# Checks montgomery_computeRb and montgomery_computeMPrime (main/montgomery.c)
+# against the python reference quoted in main/montgomery.h, over random
+# moduli of the DS key sizes (and some invalid ones, which must be
+# rejected).
+#
+# Usage: montgomery-oracle.py TEST_MONTGOMERY [ COUNT ]
+
+import random
+import subprocess
+import sys
+
+def reference(n, key_size):
+    rinv = (1 << (key_size * 2)) % n
+    mprime = (pow(n, -1, 1 << 32) * -1) & 0xFFFFFFFF
+    return rinv, mprime
+
+def main():
+    binary = sys.argv[1]
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 4000
+
+    rng = random.Random(0x9e3779b9)
+
+    cases = [ ]
+    for i in range(count):
+        # Mostly the 3072-bit DS key size, plus every other word length
+        # the DS supports
+        key_size = 3072 if (i % 4) else rng.choice(range(32, 4096 + 1, 32))
+
+        n = rng.getrandbits(key_size) | (1 << (key_size - 1)) | 1
+        cases.append((n, key_size, True))
+
+    # Invalid; even, or the top bit clear
+    for key_size in (32, 1024, 3072):
+        cases.append(((rng.getrandbits(key_size) | (1 << (key_size - 1))) & ~1, key_size, False))
+        cases.append((rng.getrandbits(key_size - 1) | 1, key_size, False))
+
+    # The boundary moduli
+    for key_size in (32, 3072):
+        cases.append(((1 << key_size) - 1, key_size, True))
+        cases.append(((1 << (key_size - 1)) | 1, key_size, True))
+
+    stdin = "".join("%0*x\n" % (key_size // 4, n) for n, key_size, _ in cases)
+    result = subprocess.run([ binary ], input=stdin, capture_output=True, text=True, check=True)
+    lines = result.stdout.splitlines()
+
+    if len(lines) != len(cases):
+        print("expected %d results, got %d" % (len(cases), len(lines)))
+        return 1
+
+    failures = 0
+    for (n, key_size, valid), line in zip(cases, lines):
+        ret, retMPrime, rb, mprime = line.split()
+
+        if not valid:
+            if ret != "-1":
+                print("accepted invalid modulus %x (ret=%s)" % (n, ret))
+                failures += 1
+            continue
+
+        expected = reference(n, key_size)
+        actual = (int(rb, 16), int(mprime, 16))
+        if ret != "0" or retMPrime != "0" or actual != expected:
+            print("mismatch for %x (ret=%s, %s)" % (n, ret, retMPrime))
+            failures += 1
+
+    print("%d moduli, %d failures" % (len(cases), failures))
+
+    return 1 if failures else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
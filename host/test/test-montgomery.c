@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "montgomery.h"
+
+// Reads one big-endian hex modulus per line and writes, per line:
+//
+//   RET_RB RB MPRIME
+//
+// where RB is big-endian hex (of the same length as the modulus) and RET_RB
+// is the result of montgomery_computeRb. See montgomery-oracle.py.
+
+#define MAX_WORDS   (256)
+
+static int readHex(const char *line, uint32_t *words, size_t *count) {
+    size_t length = strlen(line);
+    if (length == 0 || (length % 8) || length / 8 > MAX_WORDS) { return -1; }
+
+    *count = length / 8;
+    for (size_t i = 0; i < *count; i++) {
+        unsigned int word = 0;
+        if (sscanf(&line[length - 8 * (i + 1)], "%8x", &word) != 1) { return -1; }
+        words[i] = word;
+    }
+
+    return 0;
+}
+
+int main() {
+    static char line[MAX_WORDS * 8 + 16];
+
+    while (fgets(line, sizeof(line), stdin)) {
+        line[strcspn(line, "\r\n")] = 0;
+
+        uint32_t M[MAX_WORDS], Rb[MAX_WORDS];
+        size_t words = 0;
+        if (readHex(line, M, &words)) {
+            fprintf(stderr, "bad modulus: %s\n", line);
+            return 1;
+        }
+
+        memset(Rb, 0, sizeof(Rb));
+        int ret = montgomery_computeRb(M, Rb, words);
+
+        uint32_t mprime = 0;
+        int retMPrime = montgomery_computeMPrime(M[0], &mprime);
+
+        printf("%d %d ", ret, retMPrime);
+        for (size_t i = words; i > 0; i--) { printf("%08x", Rb[i - 1]); }
+        printf(" %08x\n", mprime);
+    }
+
+    return 0;
+}
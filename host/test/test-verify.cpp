@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include <openssl/bn.h>
+#include <openssl/rand.h>
+
+#include "keccak.h"
+#include "lanes.h"
+#include "modulus.h"
+#include "secp256k1.h"
+
+using namespace pixie;
+
+// Checks the verifier primitives: keccak256 and signer recovery against
+// known vectors (recovering the sample authority hashes a multi-block
+// message), Modulus::powE against OpenSSL on random moduli, and each lane
+// kernel the CPU supports against Modulus::powE
+
+static int failures = 0;
+
+static void check(bool ok, const char *name) {
+    if (!ok) {
+        printf("! %s\n", name);
+        failures++;
+    }
+}
+
+static void toHex(const uint8_t *data, size_t length, char *hex) {
+    for (size_t i = 0; i < length; i++) { sprintf(&hex[2 * i], "%02x", data[i]); }
+}
+
+static void testKeccak() {
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+    char hex[2 * KECCAK256_DIGEST_LENGTH + 1];
+
+    keccak256((const uint8_t*)"", 0, digest);
+    toHex(digest, sizeof(digest), hex);
+    check(strcmp(hex, "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470") == 0,
+      "keccak256 empty");
+}
+
+// The authority of the sample proof in host/test/proofs.txt
+static void testRecover() {
+    Secp256k1 secp256k1;
+
+    static const char *prefix = "model=00000105 serial=0000000a pubkey=";
+    static const char *pubkeyN =
+      "bc08e652d2086d1a2e1a2ad4fb62a01a37e5e7c3942bd6ab1e9dced20e4a59cd"
+      "55664e392d9cd08e395c902e064b94b6e50466af384c32681214a630f96edaa1"
+      "20090ff652c6030d941bc86d519c6ee6829d8742b5603dbd1ed84bf1577fa19a"
+      "8259f9ecc2bf17cc4dd8ceb08b551c56df99fbb9efbaca0fa2003c1c00828cee"
+      "d768f3fe92408e22ed94c2d690f363e81974665aed622ac0baa8b92b6c03f92c"
+      "47435df683a0d8346d2e6caad0ad04899091d207c2295eb0c533a677faf2261e"
+      "7d55f179c7b8fefd1aa69c90dc94f920f946548afcf69c64551af02e46a150d1"
+      "1f6c68f7fb6d5ec3eb41ab72a6fa13db842a2f561f3d70064ed38e093a55c57d"
+      "b7cc4e8bcef7015791482c0628fa7637106e43d55067bf18301d18c861d1ee12"
+      "78442f3a7f6633cf64ba863235a738b31471c2f38c8796fe3227ddff8de53442"
+      "3e914c652d6a35b97ea4a69367d96d03662549a7eb768a8c34d307ebf36de357"
+      "46691366623b5834b549aaa62d3e9e7b8b538d2003b71c1909e09daa44753ec3";
+    static const char *signature =
+      "6e03af0670294a672070143ee8a7554ed32b7bac28877f7540eed73b5880653c"
+      "9277f64eeac7b61cd66d6509403b573c9c379f8df7a7979e009eb5cac52728aa";
+
+    uint8_t sig[COMPACT_SIGNATURE_LENGTH];
+    for (size_t i = 0; i < sizeof(sig); i++) { sscanf(&signature[2 * i], "%2hhx", &sig[i]); }
+
+    uint8_t address[ADDRESS_LENGTH];
+    char hex[2 * ADDRESS_LENGTH + 1];
+
+    bool ok = secp256k1.recoverMessage(std::string(prefix) + pubkeyN, sig, address);
+    toHex(address, sizeof(address), hex);
+    check(ok && strcmp(hex, "70cd34d96e58876a25445dd75f54630d99258182") == 0,
+      "recover sample authority");
+
+    // A different message recovers a different signer
+    ok = secp256k1.recoverMessage(std::string(prefix) + "00", sig, address);
+    toHex(address, sizeof(address), hex);
+    check(!ok || strcmp(hex, "70cd34d96e58876a25445dd75f54630d99258182") != 0,
+      "recover other message");
+
+    // r = 0 is never valid
+    memset(sig, 0, 32);
+    check(!secp256k1.recoverMessage(prefix, sig, address), "reject r = 0");
+}
+
+static void testPowE(int bits, int count) {
+    BN_CTX *ctx = BN_CTX_new();
+    BIGNUM *n = BN_new(), *s = BN_new(), *e = BN_new(), *r = BN_new();
+    BN_set_word(e, 65537);
+
+    size_t length = bits / 8;
+    uint8_t nBytes[Modulus::MaxLength], sBytes[Modulus::MaxLength];
+    uint8_t expected[Modulus::MaxLength], result[Modulus::MaxLength];
+
+    for (int i = 0; i < count; i++) {
+        BN_rand(n, bits, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+        BN_rand_range(s, n);
+
+        BN_bn2binpad(n, nBytes, length);
+        BN_bn2binpad(s, sBytes, length);
+        BN_mod_exp(r, s, e, n, ctx);
+        BN_bn2binpad(r, expected, length);
+
+        Modulus modulus(nBytes, length);
+        check(modulus.powE(sBytes, result) && memcmp(result, expected, length) == 0,
+          "powE matches OpenSSL");
+
+        // Unreduced signatures are rejected
+        check(!modulus.powE(nBytes, result), "powE rejects sig = N");
+    }
+
+    BN_free(n); BN_free(s); BN_free(e); BN_free(r);
+    BN_CTX_free(ctx);
+}
+
+// Each lane gets its own random modulus; sigs include the edge cases
+// 0, 1 and N - 1, and partial batches leave lanes unused
+static void testLanes(LaneKernel kernel, int bits, int batches) {
+    if (!laneKernelSupported(kernel)) {
+        printf("? skipping %s kernel (unsupported CPU)\n", laneKernelName(kernel));
+        return;
+    }
+
+    const size_t width = laneKernelWidth(kernel);
+    const size_t length = bits / 8;
+
+    BIGNUM *n = BN_new(), *s = BN_new();
+
+    uint8_t nBytes[LANE_MAX_WIDTH][Modulus::MaxLength];
+    uint8_t sBytes[LANE_MAX_WIDTH][Modulus::MaxLength];
+    uint8_t results[LANE_MAX_WIDTH][Modulus::MaxLength];
+    uint8_t expected[Modulus::MaxLength];
+
+    for (int batch = 0; batch < batches; batch++) {
+        size_t count = 1 + (batch % width);
+
+        std::vector<Modulus> moduli;
+        std::vector<LaneModulus> laneModuli;
+        moduli.reserve(count);
+        laneModuli.reserve(count);
+
+        const LaneModulus *lanePointers[LANE_MAX_WIDTH];
+        const uint8_t *sigs[LANE_MAX_WIDTH];
+        uint8_t *outputs[LANE_MAX_WIDTH];
+
+        for (size_t lane = 0; lane < count; lane++) {
+            BN_rand(n, bits, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+            switch ((batch + lane) % 16) {
+                case 0: BN_zero(s); break;
+                case 1: BN_one(s); break;
+                case 2: BN_sub(s, n, BN_value_one()); break;
+                default: BN_rand_range(s, n);
+            }
+
+            BN_bn2binpad(n, nBytes[lane], length);
+            BN_bn2binpad(s, sBytes[lane], length);
+
+            moduli.emplace_back(nBytes[lane], length);
+            laneModuli.emplace_back(moduli.back(), kernel);
+
+            lanePointers[lane] = &laneModuli.back();
+            sigs[lane] = sBytes[lane];
+            outputs[lane] = results[lane];
+        }
+
+        powELanes(lanePointers, sigs, outputs, count);
+
+        for (size_t lane = 0; lane < count; lane++) {
+            moduli[lane].powE(sBytes[lane], expected);
+            check(memcmp(results[lane], expected, length) == 0,
+              laneKernelName(kernel));
+        }
+    }
+
+    BN_free(n); BN_free(s);
+}
+
+int main() {
+    testKeccak();
+    testRecover();
+
+    testPowE(3072, 200);
+    testPowE(2048, 50);
+    testPowE(64, 1000);
+
+    for (LaneKernel kernel : { LaneKernelAvx2, LaneKernelIfma }) {
+        testLanes(kernel, 3072, 100);
+        testLanes(kernel, 2048, 40);
+        testLanes(kernel, 64, 400);
+    }
+
+    if (failures) {
+        printf("! %d checks failed\n", failures);
+        return 1;
+    }
+
+    printf("verify: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include "keccak.h"
+
+#include <string.h>
+
+
+namespace pixie {
+
+static const uint64_t RoundConstants[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+static const int Rotations[24] = {
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+    27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+};
+
+static const int Lanes[24] = {
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+    15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+};
+
+static inline uint64_t rotl(uint64_t x, int n) {
+    return (x << n) | (x >> (64 - n));
+}
+
+static void keccakf(uint64_t *state) {
+    for (int round = 0; round < 24; round++) {
+        // Theta
+        uint64_t c[5];
+        for (int x = 0; x < 5; x++) {
+            c[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
+        }
+        for (int x = 0; x < 5; x++) {
+            uint64_t d = c[(x + 4) % 5] ^ rotl(c[(x + 1) % 5], 1);
+            for (int y = 0; y < 25; y += 5) { state[y + x] ^= d; }
+        }
+
+        // Rho and pi
+        uint64_t carry = state[1];
+        for (int i = 0; i < 24; i++) {
+            int lane = Lanes[i];
+            uint64_t next = state[lane];
+            state[lane] = rotl(carry, Rotations[i]);
+            carry = next;
+        }
+
+        // Chi
+        for (int y = 0; y < 25; y += 5) {
+            uint64_t row[5];
+            for (int x = 0; x < 5; x++) { row[x] = state[y + x]; }
+            for (int x = 0; x < 5; x++) {
+                state[y + x] = row[x] ^ ((~row[(x + 1) % 5]) & row[(x + 2) % 5]);
+            }
+        }
+
+        // Iota
+        state[0] ^= RoundConstants[round];
+    }
+}
+
+void keccak256(const uint8_t *data, size_t length, uint8_t *digest) {
+    const size_t rate = 136;
+
+    uint64_t state[25];
+    memset(state, 0, sizeof(state));
+
+    uint8_t block[rate];
+    while (true) {
+        size_t count = (length < rate) ? length: rate;
+        memset(block, 0, rate);
+        memcpy(block, data, count);
+
+        if (count < rate) {
+            block[count] ^= 0x01;
+            block[rate - 1] ^= 0x80;
+        }
+
+        for (size_t i = 0; i < rate / 8; i++) {
+            uint64_t lane = 0;
+            for (int j = 7; j >= 0; j--) { lane = (lane << 8) | block[8 * i + j]; }
+            state[i] ^= lane;
+        }
+        keccakf(state);
+
+        if (count < rate) { break; }
+        data += rate;
+        length -= rate;
+    }
+
+    for (size_t i = 0; i < KECCAK256_DIGEST_LENGTH; i++) {
+        digest[i] = state[i / 8] >> (8 * (i % 8));
+    }
+}
+
+}  // namespace pixie
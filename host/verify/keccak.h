@@ -0,0 +1,17 @@
+#ifndef __KECCAK_H__
+#define __KECCAK_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace pixie {
+
+#define KECCAK256_DIGEST_LENGTH   (32)
+
+// Ethereum's keccak256 (the original Keccak padding, not SHA3-256)
+void keccak256(const uint8_t *data, size_t length, uint8_t *digest);
+
+}  // namespace pixie
+
+#endif /* __KECCAK_H__ */
@@ -0,0 +1,379 @@
+#include "lanes.h"
+
+#include <immintrin.h>
+#include <stdexcept>
+#include <string.h>
+
+
+namespace pixie {
+
+// AVX2 accumulates whole 56-bit products, so a column holds at most
+// limbs * 2^57 before it is carried; 127 limbs keeps that below 2^64
+#define AVX2_BITS        (28)
+#define AVX2_WIDTH       (4)
+#define AVX2_MAX_LIMBS   (127)
+#define AVX2_MAX_LENGTH  (384)
+
+#define IFMA_BITS        (52)
+#define IFMA_WIDTH       (8)
+#define IFMA_MAX_LIMBS   ((8 * Modulus::MaxLength + 2 + IFMA_BITS - 1) / IFMA_BITS)
+
+
+///////////////////////////////
+// Kernel selection
+
+bool laneKernelSupported(LaneKernel kernel) {
+    switch (kernel) {
+        case LaneKernelScalar:
+            return true;
+        case LaneKernelAvx2:
+            return __builtin_cpu_supports("avx2");
+        case LaneKernelIfma:
+            return __builtin_cpu_supports("avx512f") &&
+              __builtin_cpu_supports("avx512ifma");
+    }
+    return false;
+}
+
+LaneKernel laneKernelBest() {
+    if (laneKernelSupported(LaneKernelIfma)) { return LaneKernelIfma; }
+    if (laneKernelSupported(LaneKernelAvx2)) { return LaneKernelAvx2; }
+    return LaneKernelScalar;
+}
+
+size_t laneKernelWidth(LaneKernel kernel) {
+    switch (kernel) {
+        case LaneKernelScalar: return 1;
+        case LaneKernelAvx2: return AVX2_WIDTH;
+        case LaneKernelIfma: return IFMA_WIDTH;
+    }
+    return 1;
+}
+
+const char* laneKernelName(LaneKernel kernel) {
+    switch (kernel) {
+        case LaneKernelScalar: return "scalar";
+        case LaneKernelAvx2: return "avx2";
+        case LaneKernelIfma: return "ifma";
+    }
+    return "unknown";
+}
+
+bool laneKernelFromName(const char *name, LaneKernel *kernel) {
+    for (LaneKernel k : { LaneKernelScalar, LaneKernelAvx2, LaneKernelIfma }) {
+        if (strcmp(name, laneKernelName(k)) == 0) {
+            *kernel = k;
+            return true;
+        }
+    }
+    return false;
+}
+
+static unsigned radixBits(LaneKernel kernel) {
+    return (kernel == LaneKernelIfma) ? IFMA_BITS: AVX2_BITS;
+}
+
+
+///////////////////////////////
+// Radix conversion
+
+// Little-endian 32-bit words to limbs of bits each
+static void toRadix(const uint32_t *words, size_t count, unsigned bits,
+  size_t limbs, uint64_t *out) {
+
+    const uint64_t mask = (1ULL << bits) - 1;
+
+    for (size_t i = 0; i < limbs; i++) {
+        size_t bit = i * bits;
+        uint64_t limb = 0;
+        for (size_t b = 0; b < bits; b += 32 - ((bit + b) % 32)) {
+            size_t index = (bit + b) / 32;
+            if (index >= count) { break; }
+            limb |= ((uint64_t)(words[index] >> ((bit + b) % 32))) << b;
+        }
+        out[i] = limb & mask;
+    }
+}
+
+static void bytesToWords(const uint8_t *data, size_t length, uint32_t *words) {
+    for (size_t i = 0; i < length / 4; i++) {
+        const uint8_t *word = &data[length - 4 * (i + 1)];
+        words[i] = ((uint32_t)word[0] << 24) | (word[1] << 16) | (word[2] << 8) | word[3];
+    }
+}
+
+// x = 2x mod N, for x < N
+static void modDouble(uint32_t *x, const uint32_t *n, size_t count) {
+    uint32_t top = x[count - 1] >> 31;
+    for (size_t i = count - 1; i > 0; i--) { x[i] = (x[i] << 1) | (x[i - 1] >> 31); }
+    x[0] <<= 1;
+
+    bool subtract = top;
+    if (!subtract) {
+        subtract = true;
+        for (size_t i = count; i > 0; i--) {
+            if (x[i - 1] != n[i - 1]) {
+                subtract = (x[i - 1] > n[i - 1]);
+                break;
+            }
+        }
+    }
+
+    if (subtract) {
+        uint64_t borrow = 0;
+        for (size_t i = 0; i < count; i++) {
+            uint64_t v = (uint64_t)x[i] - n[i] - borrow;
+            x[i] = (uint32_t)v;
+            borrow = (v >> 32) & 1;
+        }
+    }
+}
+
+
+///////////////////////////////
+// LaneModulus
+
+LaneModulus::LaneModulus(const Modulus &modulus, LaneKernel kernel) :
+  kernel_(kernel), length_(modulus.length()) {
+
+    if (kernel != LaneKernelAvx2 && kernel != LaneKernelIfma) {
+        throw std::invalid_argument("not a SIMD kernel");
+    }
+    if (kernel == LaneKernelAvx2 && length_ > AVX2_MAX_LENGTH) {
+        throw std::invalid_argument("modulus too large for AVX2");
+    }
+
+    const unsigned bits = radixBits(kernel);
+    limbs_ = (8 * length_ + 2 + bits - 1) / bits;
+
+    const std::vector<uint32_t> &words = modulus.words();
+    const size_t count = words.size();
+
+    // Modulus::rr is 2^(2 * 8 * length) mod N; double up to R = 2^(bits * limbs)
+    std::vector<uint32_t> rr = modulus.rr();
+    for (size_t i = 16 * length_; i < 2 * bits * limbs_; i++) {
+        modDouble(rr.data(), words.data(), count);
+    }
+
+    n_.resize(limbs_);
+    rr_.resize(limbs_);
+    toRadix(words.data(), count, bits, limbs_, n_.data());
+    toRadix(rr.data(), count, bits, limbs_, rr_.data());
+
+    // -N^-1 mod 2^bits (see Modulus)
+    uint64_t n0 = ((uint64_t)words[1] << 32) | words[0];
+    uint64_t inv = n0;
+    for (int i = 0; i < 5; i++) { inv *= 2 - n0 * inv; }
+    k0_ = (-inv) & ((1ULL << bits) - 1);
+}
+
+
+///////////////////////////////
+// AVX-512 IFMA kernel; 8 lanes of 52-bit limbs
+
+// v >> IFMA_BITS per lane; the zero-masked form, since GCC 12 warns
+// (-Wmaybe-uninitialized) on the undefined pass-through _mm512_srli_epi64
+// uses internally
+__attribute__((target("avx512f")))
+static inline __m512i carryIfma(__m512i v) {
+    return _mm512_maskz_srli_epi64((__mmask8)0xff, v, IFMA_BITS);
+}
+
+// out = a * b * R^-1 mod N (< 2N, for a, b < 2N), with normalized limbs;
+// out may alias a or b
+__attribute__((target("avx512f,avx512ifma")))
+static void montMulIfma(size_t L, const __m512i *a, const __m512i *b,
+  const __m512i *n, __m512i k0, __m512i *t, __m512i *out) {
+
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64((1ULL << IFMA_BITS) - 1);
+
+    for (size_t k = 0; k < 2 * L; k++) { t[k] = zero; }
+
+    for (size_t i = 0; i < L; i++) {
+        __m512i *ti = &t[i];
+
+        const __m512i bi = b[i];
+        for (size_t j = 0; j < L; j++) {
+            ti[j] = _mm512_madd52lo_epu64(ti[j], a[j], bi);
+            ti[j + 1] = _mm512_madd52hi_epu64(ti[j + 1], a[j], bi);
+        }
+
+        // Only the low 52 bits of t[i] matter for m
+        const __m512i m = _mm512_madd52lo_epu64(zero, ti[0], k0);
+        for (size_t j = 0; j < L; j++) {
+            ti[j] = _mm512_madd52lo_epu64(ti[j], n[j], m);
+            ti[j + 1] = _mm512_madd52hi_epu64(ti[j + 1], n[j], m);
+        }
+
+        ti[1] = _mm512_add_epi64(ti[1], carryIfma(ti[0]));
+    }
+
+    __m512i carry = zero;
+    for (size_t j = 0; j < L; j++) {
+        __m512i v = _mm512_add_epi64(t[L + j], carry);
+        out[j] = _mm512_and_si512(v, mask);
+        carry = carryIfma(v);
+    }
+}
+
+// y = x^65537 * R^-1 * R (< 2N); see Modulus::powE
+__attribute__((target("avx512f,avx512ifma")))
+static void powEIfma(size_t L, const uint64_t *n, const uint64_t *rr,
+  const uint64_t *k0, const uint64_t *x, uint64_t *y) {
+
+    __m512i N[IFMA_MAX_LIMBS], RR[IFMA_MAX_LIMBS];
+    __m512i X[IFMA_MAX_LIMBS], Y[IFMA_MAX_LIMBS];
+    __m512i T[2 * IFMA_MAX_LIMBS];
+
+    for (size_t j = 0; j < L; j++) {
+        N[j] = _mm512_loadu_si512(&n[IFMA_WIDTH * j]);
+        RR[j] = _mm512_loadu_si512(&rr[IFMA_WIDTH * j]);
+        X[j] = _mm512_loadu_si512(&x[IFMA_WIDTH * j]);
+    }
+    const __m512i K0 = _mm512_loadu_si512(k0);
+
+    montMulIfma(L, X, RR, N, K0, T, Y);
+    for (int i = 0; i < 16; i++) { montMulIfma(L, Y, Y, N, K0, T, Y); }
+    montMulIfma(L, Y, X, N, K0, T, Y);
+
+    for (size_t j = 0; j < L; j++) { _mm512_storeu_si512(&y[IFMA_WIDTH * j], Y[j]); }
+}
+
+
+///////////////////////////////
+// AVX2 kernel; 4 lanes of 28-bit limbs
+
+// As montMulIfma, but each 28x28-bit product is accumulated whole
+__attribute__((target("avx2")))
+static void montMulAvx2(size_t L, const __m256i *a, const __m256i *b,
+  const __m256i *n, __m256i k0, __m256i *t, __m256i *out) {
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i mask = _mm256_set1_epi64x((1ULL << AVX2_BITS) - 1);
+
+    for (size_t k = 0; k < 2 * L; k++) { t[k] = zero; }
+
+    for (size_t i = 0; i < L; i++) {
+        __m256i *ti = &t[i];
+
+        const __m256i bi = b[i];
+        for (size_t j = 0; j < L; j++) {
+            ti[j] = _mm256_add_epi64(ti[j], _mm256_mul_epu32(a[j], bi));
+        }
+
+        // Only the low 28 bits of t[i] matter for m
+        const __m256i m = _mm256_and_si256(_mm256_mul_epu32(ti[0], k0), mask);
+        for (size_t j = 0; j < L; j++) {
+            ti[j] = _mm256_add_epi64(ti[j], _mm256_mul_epu32(n[j], m));
+        }
+
+        ti[1] = _mm256_add_epi64(ti[1], _mm256_srli_epi64(ti[0], AVX2_BITS));
+    }
+
+    __m256i carry = zero;
+    for (size_t j = 0; j < L; j++) {
+        __m256i v = _mm256_add_epi64(t[L + j], carry);
+        out[j] = _mm256_and_si256(v, mask);
+        carry = _mm256_srli_epi64(v, AVX2_BITS);
+    }
+}
+
+__attribute__((target("avx2")))
+static void powEAvx2(size_t L, const uint64_t *n, const uint64_t *rr,
+  const uint64_t *k0, const uint64_t *x, uint64_t *y) {
+
+    __m256i N[AVX2_MAX_LIMBS], RR[AVX2_MAX_LIMBS];
+    __m256i X[AVX2_MAX_LIMBS], Y[AVX2_MAX_LIMBS];
+    __m256i T[2 * AVX2_MAX_LIMBS];
+
+    for (size_t j = 0; j < L; j++) {
+        N[j] = _mm256_loadu_si256((const __m256i*)&n[AVX2_WIDTH * j]);
+        RR[j] = _mm256_loadu_si256((const __m256i*)&rr[AVX2_WIDTH * j]);
+        X[j] = _mm256_loadu_si256((const __m256i*)&x[AVX2_WIDTH * j]);
+    }
+    const __m256i K0 = _mm256_loadu_si256((const __m256i*)k0);
+
+    montMulAvx2(L, X, RR, N, K0, T, Y);
+    for (int i = 0; i < 16; i++) { montMulAvx2(L, Y, Y, N, K0, T, Y); }
+    montMulAvx2(L, Y, X, N, K0, T, Y);
+
+    for (size_t j = 0; j < L; j++) { _mm256_storeu_si256((__m256i*)&y[AVX2_WIDTH * j], Y[j]); }
+}
+
+
+///////////////////////////////
+// Batches
+
+void powELanes(const LaneModulus *const *moduli, const uint8_t *const *sigs,
+  uint8_t *const *results, size_t count) {
+
+    if (count == 0) { return; }
+
+    const LaneKernel kernel = moduli[0]->kernel();
+    const size_t W = laneKernelWidth(kernel);
+    const size_t L = moduli[0]->limbs();
+    const size_t length = moduli[0]->length();
+    const unsigned bits = radixBits(kernel);
+
+    if (count > W) { throw std::invalid_argument("too many proofs for kernel"); }
+    for (size_t lane = 1; lane < count; lane++) {
+        if (moduli[lane]->kernel() != kernel || moduli[lane]->length() != length) {
+            throw std::invalid_argument("mixed moduli in batch");
+        }
+    }
+
+    // Interleave the lanes (limb j of lane l at j * W + l); unused lanes
+    // repeat the first proof
+    std::vector<uint64_t> n(L * W), rr(L * W), x(L * W), y(L * W), k0(W);
+    std::vector<uint32_t> words(length / 4);
+    std::vector<uint64_t> limbs(L);
+
+    for (size_t lane = 0; lane < W; lane++) {
+        size_t source = (lane < count) ? lane: 0;
+        const LaneModulus *modulus = moduli[source];
+
+        bytesToWords(sigs[source], length, words.data());
+        toRadix(words.data(), words.size(), bits, L, limbs.data());
+
+        for (size_t j = 0; j < L; j++) {
+            n[j * W + lane] = modulus->n()[j];
+            rr[j * W + lane] = modulus->rr()[j];
+            x[j * W + lane] = limbs[j];
+        }
+        k0[lane] = modulus->k0();
+    }
+
+    if (kernel == LaneKernelIfma) {
+        powEIfma(L, n.data(), rr.data(), k0.data(), x.data(), y.data());
+    } else {
+        powEAvx2(L, n.data(), rr.data(), k0.data(), x.data(), y.data());
+    }
+
+    // Reduce each lane below N and write it out big-endian
+    const uint64_t mask = (1ULL << bits) - 1;
+    for (size_t lane = 0; lane < count; lane++) {
+        const uint64_t *nl = moduli[lane]->n();
+
+        int64_t borrow = 0;
+        for (size_t j = 0; j < L; j++) {
+            int64_t v = (int64_t)y[j * W + lane] - (int64_t)nl[j] + borrow;
+            limbs[j] = (uint64_t)v & mask;
+            borrow = v >> bits;
+        }
+        if (borrow < 0) {
+            for (size_t j = 0; j < L; j++) { limbs[j] = y[j * W + lane]; }
+        }
+
+        uint8_t *result = results[lane];
+        memset(result, 0, length);
+        for (size_t bit = 0; bit < 8 * length; bit += 8) {
+            size_t index = bit / bits, shift = bit % bits;
+            uint64_t v = limbs[index] >> shift;
+            if (shift + 8 > bits && index + 1 < L) { v |= limbs[index + 1] << (bits - shift); }
+            result[length - 1 - bit / 8] = v;
+        }
+    }
+}
+
+}  // namespace pixie
@@ -0,0 +1,77 @@
+#ifndef __LANES_H__
+#define __LANES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "modulus.h"
+
+
+namespace pixie {
+
+// SIMD kernels which compute sig^65537 mod N for several proofs at once,
+// one proof (with its own modulus) per lane; the scalar kernel is the
+// fallback, using Modulus::powE one proof at a time.
+//
+// Each lane keeps its values in a limb radix the kernel can multiply
+// (52-bit for AVX-512 IFMA, 28-bit for AVX2), with R >= 4N so products
+// only need reducing below N once, at the end.
+enum LaneKernel {
+    LaneKernelScalar = 0,
+    LaneKernelAvx2,
+    LaneKernelIfma
+};
+
+#define LANE_MAX_WIDTH   (8)
+
+// The fastest kernel this CPU supports
+LaneKernel laneKernelBest();
+
+bool laneKernelSupported(LaneKernel kernel);
+
+// The number of proofs per call; 1, 4 or 8
+size_t laneKernelWidth(LaneKernel kernel);
+
+const char* laneKernelName(LaneKernel kernel);
+
+// Returns false for an unknown name
+bool laneKernelFromName(const char *name, LaneKernel *kernel);
+
+// A modulus converted to a SIMD kernel's radix; build once per modulus
+// (like Modulus) and cache alongside it
+class LaneModulus {
+  public:
+    // Throws std::invalid_argument if the kernel is not a SIMD kernel, or
+    // the modulus is too large for it (AVX2 supports up to 3072 bits)
+    LaneModulus(const Modulus &modulus, LaneKernel kernel);
+
+    LaneKernel kernel() const { return kernel_; }
+    size_t length() const { return length_; }
+    size_t limbs() const { return limbs_; }
+
+    const uint64_t* n() const { return n_.data(); }
+    const uint64_t* rr() const { return rr_.data(); }
+    uint64_t k0() const { return k0_; }
+
+  private:
+    LaneKernel kernel_;
+    size_t length_;
+    size_t limbs_;
+
+    std::vector<uint64_t> n_;
+    std::vector<uint64_t> rr_;
+    uint64_t k0_;
+};
+
+// Computes results[i] = sigs[i]^65537 mod N_i for count proofs, up to the
+// kernel's width; the moduli must share a kernel and length, and each sig
+// must be reduced (see Modulus::reduced). Unused lanes cost the same as
+// used ones.
+void powELanes(const LaneModulus *const *moduli, const uint8_t *const *sigs,
+  uint8_t *const *results, size_t count);
+
+}  // namespace pixie
+
+#endif /* __LANES_H__ */
@@ -0,0 +1,128 @@
+#include "modulus.h"
+
+#include <stdexcept>
+#include <string.h>
+
+#include "montgomery.h"
+
+
+namespace pixie {
+
+typedef unsigned __int128 uint128_t;
+
+static const size_t MaxLimbs = Modulus::MaxLength / 8;
+
+Modulus::Modulus(const uint8_t *n, size_t length) : limbs_(length / 8) {
+    if (length == 0 || length > MaxLength || (length % 8) || (n[0] & 0x80) == 0 || (n[length - 1] & 1) == 0) {
+        throw std::invalid_argument("modulus must be odd, with its top bit set");
+    }
+
+    // Big-endian bytes to little-endian words
+    size_t count = length / 4;
+    words_.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *word = &n[length - 4 * (i + 1)];
+        words_[i] = ((uint32_t)word[0] << 24) | (word[1] << 16) | (word[2] << 8) | word[3];
+    }
+
+    // R^2 = 2^(2k) mod N, exactly as the firmware computes Rb
+    rrWords_.resize(count);
+    if (montgomery_computeRb(words_.data(), rrWords_.data(), count)) {
+        throw std::invalid_argument("failed to compute R^2 mod N");
+    }
+
+    n_.resize(limbs_);
+    rr_.resize(limbs_);
+    for (size_t i = 0; i < limbs_; i++) {
+        n_[i] = ((uint64_t)words_[2 * i + 1] << 32) | words_[2 * i];
+        rr_[i] = ((uint64_t)rrWords_[2 * i + 1] << 32) | rrWords_[2 * i];
+    }
+
+    // -N^-1 mod 2^64, by Newton iteration (see montgomery_computeMPrime)
+    uint64_t inv = n_[0];
+    for (int i = 0; i < 5; i++) { inv *= 2 - n_[0] * inv; }
+    n0inv_ = -inv;
+}
+
+// Coarsely integrated operand scanning (CIOS)
+void Modulus::mul(const uint64_t *a, const uint64_t *b, uint64_t *out) const {
+    const size_t L = limbs_;
+
+    uint64_t t[MaxLimbs + 2];
+    memset(t, 0, (L + 2) * sizeof(uint64_t));
+
+    for (size_t i = 0; i < L; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < L; j++) {
+            uint128_t v = (uint128_t)a[i] * b[j] + t[j] + carry;
+            t[j] = (uint64_t)v;
+            carry = v >> 64;
+        }
+        uint128_t v = (uint128_t)t[L] + carry;
+        t[L] = (uint64_t)v;
+        t[L + 1] = v >> 64;
+
+        uint64_t m = t[0] * n0inv_;
+        v = (uint128_t)m * n_[0] + t[0];
+        carry = v >> 64;
+        for (size_t j = 1; j < L; j++) {
+            v = (uint128_t)m * n_[j] + t[j] + carry;
+            t[j - 1] = (uint64_t)v;
+            carry = v >> 64;
+        }
+        v = (uint128_t)t[L] + carry;
+        t[L - 1] = (uint64_t)v;
+        t[L] = t[L + 1] + (uint64_t)(v >> 64);
+    }
+
+    // t < 2N; subtract N if t >= N
+    uint64_t diff[MaxLimbs];
+    uint64_t borrow = 0;
+    for (size_t j = 0; j < L; j++) {
+        uint128_t v = (uint128_t)t[j] - n_[j] - borrow;
+        diff[j] = (uint64_t)v;
+        borrow = (uint64_t)(v >> 64) & 1;
+    }
+
+    bool subtract = (t[L] != 0) || (borrow == 0);
+    memcpy(out, subtract ? diff: t, L * sizeof(uint64_t));
+}
+
+bool Modulus::reduced(const uint8_t *value) const {
+    size_t length = limbs_ * 8;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t nByte = words_[(length - 1 - i) / 4] >> (8 * ((length - 1 - i) % 4));
+        if (value[i] != nByte) { return value[i] < nByte; }
+    }
+    return false;
+}
+
+// sig^65537 = sig^(2^16) * sig; converting into the Montgomery domain,
+// 16 squarings, then a final multiply by the plain sig (which also
+// converts back out of the domain), for 18 products in all
+bool Modulus::powE(const uint8_t *sig, uint8_t *result) const {
+    if (!reduced(sig)) { return false; }
+
+    const size_t L = limbs_;
+
+    uint64_t s[MaxLimbs], x[MaxLimbs];
+    for (size_t i = 0; i < L; i++) {
+        uint64_t limb = 0;
+        for (size_t j = 0; j < 8; j++) { limb = (limb << 8) | sig[8 * (L - 1 - i) + j]; }
+        s[i] = limb;
+    }
+
+    mul(s, rr_.data(), x);
+    for (int i = 0; i < 16; i++) { mul(x, x, x); }
+    mul(x, s, x);
+
+    for (size_t i = 0; i < L; i++) {
+        for (size_t j = 0; j < 8; j++) {
+            result[8 * (L - 1 - i) + j] = x[i] >> (8 * (7 - j));
+        }
+    }
+
+    return true;
+}
+
+}  // namespace pixie
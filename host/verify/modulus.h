@@ -0,0 +1,54 @@
+#ifndef __MODULUS_H__
+#define __MODULUS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+
+namespace pixie {
+
+// A Montgomery context for one RSA modulus, which verifiers cache per
+// device; building it costs about as much as a few exponentiations, so
+// repeat devices only pay for powE.
+class Modulus {
+  public:
+    static const size_t MaxLength = 512;
+
+    // From a big-endian modulus of length bytes; throws std::invalid_argument
+    // unless it is odd, a multiple of 8 bytes (at most MaxLength) and has its
+    // top bit set
+    Modulus(const uint8_t *n, size_t length);
+
+    size_t length() const { return limbs_ * 8; }
+
+    // Computes result = sig^65537 mod N (big-endian, length() bytes each).
+    // Returns false (without computing) if sig is not reduced, which is
+    // never a valid signature.
+    bool powE(const uint8_t *sig, uint8_t *result) const;
+
+    // The modulus and R^2 mod N (R = 2^(8 * length())) as little-endian
+    // 32-bit words, e.g. for converting to other limb sizes
+    const std::vector<uint32_t>& words() const { return words_; }
+    const std::vector<uint32_t>& rr() const { return rrWords_; }
+
+    // Returns true if the big-endian value (length() bytes) is below N
+    bool reduced(const uint8_t *value) const;
+
+  private:
+    size_t limbs_;
+    std::vector<uint64_t> n_;
+    std::vector<uint64_t> rr_;
+    uint64_t n0inv_;
+
+    std::vector<uint32_t> words_;
+    std::vector<uint32_t> rrWords_;
+
+    // out = a * b * R^-1 mod N, fully reduced; out may alias a or b
+    void mul(const uint64_t *a, const uint64_t *b, uint64_t *out) const;
+};
+
+}  // namespace pixie
+
+#endif /* __MODULUS_H__ */
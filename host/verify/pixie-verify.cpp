@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "verifier.h"
+
+using namespace pixie;
+
+// Verifies a file of ATTEST proofs (one hex proof per line) across all
+// cores; each thread keeps its own Verifier, so repeat devices only pay
+// for the RSA check, which runs through the fastest lane kernel (see
+// lanes.h) unless one is given
+//
+// Usage: pixie-verify [ --kernel scalar|avx2|ifma ] PROOFS_FILE [ THREADS ]
+
+// Proofs per Verifier::verifyBatch call
+#define BATCH_SIZE   (64)
+
+struct Proof {
+    int line;
+    std::vector<uint8_t> data;
+};
+
+struct Failure {
+    int line;
+    VerifyResult result;
+};
+
+static int fromHex(char c) {
+    if (c >= '0' && c <= '9') { return c - '0'; }
+    if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+    if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+    return -1;
+}
+
+// Returns false on a malformed line
+static bool parseHex(const std::string &hex, std::vector<uint8_t> &data) {
+    size_t offset = (hex.compare(0, 2, "0x") == 0) ? 2: 0;
+    if ((hex.size() - offset) % 2) { return false; }
+
+    data.clear();
+    for (size_t i = offset; i < hex.size(); i += 2) {
+        int hi = fromHex(hex[i]), lo = fromHex(hex[i + 1]);
+        if (hi < 0 || lo < 0) { return false; }
+        data.push_back((hi << 4) | lo);
+    }
+    return true;
+}
+
+static bool readProofs(const char *filename, std::vector<Proof> &proofs) {
+    std::ifstream file(filename);
+    if (!file) { return false; }
+
+    std::string line;
+    for (int i = 1; std::getline(file, line); i++) {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') { continue; }
+        line = line.substr(start, line.find_last_not_of(" \t\r") + 1 - start);
+
+        Proof proof = { i, { } };
+
+        // A malformed line fails verification as a bad version
+        parseHex(line, proof.data);
+
+        proofs.push_back(std::move(proof));
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    LaneKernel kernel = laneKernelBest();
+    if (argc >= 3 && strcmp(argv[1], "--kernel") == 0) {
+        if (!laneKernelFromName(argv[2], &kernel) || !laneKernelSupported(kernel)) {
+            fprintf(stderr, "unsupported kernel %s\n", argv[2]);
+            return 2;
+        }
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: pixie-verify [ --kernel scalar|avx2|ifma ] PROOFS_FILE [ THREADS ]\n");
+        return 2;
+    }
+
+    std::vector<Proof> proofs;
+    if (!readProofs(argv[1], proofs)) {
+        fprintf(stderr, "failed to read %s\n", argv[1]);
+        return 2;
+    }
+
+    size_t threads = std::thread::hardware_concurrency();
+    if (argc == 3) { threads = strtoul(argv[2], NULL, 10); }
+    threads = std::max((size_t)1, std::min(threads, proofs.size()));
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    // Deal the proofs round-robin, so long runs of one device are spread
+    // across the threads
+    std::vector<std::vector<Failure>> failures(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            Verifier verifier(PixieAuthority, kernel);
+
+            const Proof *batch[BATCH_SIZE];
+            const uint8_t *data[BATCH_SIZE];
+            size_t lengths[BATCH_SIZE];
+            VerifyResult results[BATCH_SIZE];
+
+            size_t i = t;
+            while (i < proofs.size()) {
+                size_t count = 0;
+                for (; count < BATCH_SIZE && i < proofs.size(); i += threads) {
+                    batch[count] = &proofs[i];
+                    data[count] = proofs[i].data.data();
+                    lengths[count] = proofs[i].data.size();
+                    count++;
+                }
+
+                verifier.verifyBatch(data, lengths, count, results);
+
+                for (size_t j = 0; j < count; j++) {
+                    if (results[j] != VerifyOk) {
+                        failures[t].push_back({ batch[j]->line, results[j] });
+                    }
+                }
+            }
+        });
+    }
+    for (auto &worker : workers) { worker.join(); }
+
+    double dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::vector<Failure> failed;
+    for (auto &chunk : failures) {
+        failed.insert(failed.end(), chunk.begin(), chunk.end());
+    }
+    std::sort(failed.begin(), failed.end(), [](const Failure &a, const Failure &b) {
+        return a.line < b.line;
+    });
+
+    for (const Failure &failure : failed) {
+        printf("line %d: %s\n", failure.line, verifyResultMessage(failure.result));
+    }
+
+    printf("{ total: %zu, passed: %zu, failed: %zu, threads: %zu, kernel: %s, seconds: %.3f, proofsPerSecond: %.0f }\n",
+      proofs.size(), proofs.size() - failed.size(), failed.size(), threads,
+      laneKernelName(kernel), dt,
+      dt > 0 ? proofs.size() / dt: 0.0);
+
+    return failed.empty() ? 0: 1;
+}
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <openssl/bn.h>
+
+#ifdef PIXIE_HAVE_MBEDTLS
+#include <mbedtls/bignum.h>
+#endif /* PIXIE_HAVE_MBEDTLS */
+
+#include "lanes.h"
+#include "modulus.h"
+
+using namespace pixie;
+
+// Compares the throughput of the RSA public operation (e=65537) for
+// 3072-bit proofs on one thread: the scalar Modulus, each lane kernel the
+// CPU supports, OpenSSL (BN_mod_exp_mont, with a cached BN_MONT_CTX per
+// modulus) and, if built with it, mbedtls (with a cached RR per modulus).
+// Every backend must agree with the scalar results.
+//
+// Usage: rsa-bench [ COUNT [ MODULI ] ]
+
+#define LENGTH   (384)
+
+struct Corpus {
+    size_t count;
+    size_t moduli;
+
+    std::vector<uint8_t> n;      // moduli * LENGTH
+    std::vector<uint8_t> sigs;   // count * LENGTH; sig i uses modulus i % moduli
+    std::vector<uint8_t> expected;
+};
+
+static void makeCorpus(Corpus &corpus) {
+    BIGNUM *n = BN_new(), *s = BN_new();
+
+    corpus.n.resize(corpus.moduli * LENGTH);
+    corpus.sigs.resize(corpus.count * LENGTH);
+
+    for (size_t i = 0; i < corpus.moduli; i++) {
+        BN_rand(n, 8 * LENGTH, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD);
+        BN_bn2binpad(n, &corpus.n[i * LENGTH], LENGTH);
+    }
+
+    for (size_t i = 0; i < corpus.count; i++) {
+        BN_bin2bn(&corpus.n[(i % corpus.moduli) * LENGTH], LENGTH, n);
+        BN_rand_range(s, n);
+        BN_bn2binpad(s, &corpus.sigs[i * LENGTH], LENGTH);
+    }
+
+    BN_free(n); BN_free(s);
+}
+
+static const uint8_t* modulusFor(const Corpus &corpus, size_t i) {
+    return &corpus.n[(i % corpus.moduli) * LENGTH];
+}
+
+// Runs setup (not timed), then run; returns false if the results differ
+// from the scalar backend
+static bool bench(const char *name, size_t width, Corpus &corpus,
+  std::function<void()> setup, std::function<void(uint8_t*)> run,
+  double *baseline) {
+
+    setup();
+
+    std::vector<uint8_t> results(corpus.count * LENGTH);
+
+    auto t0 = std::chrono::steady_clock::now();
+    run(results.data());
+    double dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    bool match = true;
+    if (corpus.expected.empty()) {
+        corpus.expected = results;
+    } else {
+        match = (results == corpus.expected);
+    }
+
+    double rate = corpus.count / dt;
+    if (*baseline == 0) { *baseline = rate; }
+
+    printf("{ backend: %s, width: %zu, opsPerSecond: %.0f, vsScalar: %.2f%s }\n",
+      name, width, rate, rate / *baseline, match ? "": ", MISMATCH: true");
+
+    return match;
+}
+
+int main(int argc, char **argv) {
+    Corpus corpus;
+    corpus.count = (argc > 1) ? strtoul(argv[1], NULL, 10): 4096;
+    corpus.moduli = (argc > 2) ? strtoul(argv[2], NULL, 10): 64;
+    if (corpus.count == 0 || corpus.moduli == 0) {
+        fprintf(stderr, "Usage: rsa-bench [ COUNT [ MODULI ] ]\n");
+        return 2;
+    }
+
+    makeCorpus(corpus);
+
+    bool ok = true;
+    double baseline = 0;
+
+    // Scalar; the baseline (and reference results)
+    std::vector<std::unique_ptr<Modulus>> moduli;
+    ok &= bench("scalar", 1, corpus, [&]() {
+        for (size_t i = 0; i < corpus.moduli; i++) {
+            moduli.emplace_back(new Modulus(modulusFor(corpus, i), LENGTH));
+        }
+    }, [&](uint8_t *results) {
+        for (size_t i = 0; i < corpus.count; i++) {
+            moduli[i % corpus.moduli]->powE(&corpus.sigs[i * LENGTH], &results[i * LENGTH]);
+        }
+    }, &baseline);
+
+    // Lane kernels
+    for (LaneKernel kernel : { LaneKernelAvx2, LaneKernelIfma }) {
+        if (!laneKernelSupported(kernel)) {
+            printf("? skipping %s (unsupported CPU)\n", laneKernelName(kernel));
+            continue;
+        }
+
+        const size_t width = laneKernelWidth(kernel);
+
+        std::vector<std::unique_ptr<LaneModulus>> laneModuli;
+        ok &= bench(laneKernelName(kernel), width, corpus, [&]() {
+            for (size_t i = 0; i < corpus.moduli; i++) {
+                laneModuli.emplace_back(new LaneModulus(*moduli[i], kernel));
+            }
+        }, [&](uint8_t *results) {
+            const LaneModulus *lanes[LANE_MAX_WIDTH];
+            const uint8_t *sigs[LANE_MAX_WIDTH];
+            uint8_t *outputs[LANE_MAX_WIDTH];
+
+            for (size_t i = 0; i < corpus.count; i += width) {
+                size_t count = std::min(width, corpus.count - i);
+                for (size_t lane = 0; lane < count; lane++) {
+                    lanes[lane] = laneModuli[(i + lane) % corpus.moduli].get();
+                    sigs[lane] = &corpus.sigs[(i + lane) * LENGTH];
+                    outputs[lane] = &results[(i + lane) * LENGTH];
+                }
+                powELanes(lanes, sigs, outputs, count);
+            }
+        }, &baseline);
+    }
+
+    // OpenSSL
+    {
+        BN_CTX *ctx = BN_CTX_new();
+        BIGNUM *e = BN_new(), *s = BN_new(), *r = BN_new();
+        BN_set_word(e, 65537);
+
+        std::vector<BIGNUM*> ns;
+        std::vector<BN_MONT_CTX*> monts;
+
+        ok &= bench("openssl", 1, corpus, [&]() {
+            for (size_t i = 0; i < corpus.moduli; i++) {
+                BIGNUM *n = BN_bin2bn(modulusFor(corpus, i), LENGTH, NULL);
+                BN_MONT_CTX *mont = BN_MONT_CTX_new();
+                BN_MONT_CTX_set(mont, n, ctx);
+                ns.push_back(n);
+                monts.push_back(mont);
+            }
+        }, [&](uint8_t *results) {
+            for (size_t i = 0; i < corpus.count; i++) {
+                size_t m = i % corpus.moduli;
+                BN_bin2bn(&corpus.sigs[i * LENGTH], LENGTH, s);
+                BN_mod_exp_mont(r, s, e, ns[m], ctx, monts[m]);
+                BN_bn2binpad(r, &results[i * LENGTH], LENGTH);
+            }
+        }, &baseline);
+
+        for (size_t i = 0; i < ns.size(); i++) {
+            BN_free(ns[i]);
+            BN_MONT_CTX_free(monts[i]);
+        }
+        BN_free(e); BN_free(s); BN_free(r);
+        BN_CTX_free(ctx);
+    }
+
+#ifdef PIXIE_HAVE_MBEDTLS
+    {
+        mbedtls_mpi e, s, r;
+        mbedtls_mpi_init(&e);
+        mbedtls_mpi_init(&s);
+        mbedtls_mpi_init(&r);
+        mbedtls_mpi_lset(&e, 65537);
+
+        std::vector<mbedtls_mpi> ns(corpus.moduli), rrs(corpus.moduli);
+
+        ok &= bench("mbedtls", 1, corpus, [&]() {
+            for (size_t i = 0; i < corpus.moduli; i++) {
+                mbedtls_mpi_init(&ns[i]);
+                mbedtls_mpi_init(&rrs[i]);
+                mbedtls_mpi_read_binary(&ns[i], modulusFor(corpus, i), LENGTH);
+
+                // Computes the cached RR
+                mbedtls_mpi_exp_mod(&r, &e, &e, &ns[i], &rrs[i]);
+            }
+        }, [&](uint8_t *results) {
+            for (size_t i = 0; i < corpus.count; i++) {
+                size_t m = i % corpus.moduli;
+                mbedtls_mpi_read_binary(&s, &corpus.sigs[i * LENGTH], LENGTH);
+                mbedtls_mpi_exp_mod(&r, &s, &e, &ns[m], &rrs[m]);
+                mbedtls_mpi_write_binary(&r, &results[i * LENGTH], LENGTH);
+            }
+        }, &baseline);
+
+        for (size_t i = 0; i < corpus.moduli; i++) {
+            mbedtls_mpi_free(&ns[i]);
+            mbedtls_mpi_free(&rrs[i]);
+        }
+        mbedtls_mpi_free(&e);
+        mbedtls_mpi_free(&s);
+        mbedtls_mpi_free(&r);
+    }
+#else
+    printf("? skipping mbedtls (not built with it)\n");
+#endif /* PIXIE_HAVE_MBEDTLS */
+
+    if (!ok) {
+        printf("! backends disagree\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include "secp256k1.h"
+
+#include <stdexcept>
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/obj_mac.h>
+
+#include "keccak.h"
+
+
+namespace pixie {
+
+Secp256k1::Secp256k1() {
+    group_ = EC_GROUP_new_by_curve_name(NID_secp256k1);
+    ctx_ = BN_CTX_new();
+    if (group_ == NULL || ctx_ == NULL) {
+        EC_GROUP_free(group_);
+        BN_CTX_free(ctx_);
+        throw std::runtime_error("failed to create secp256k1 group");
+    }
+}
+
+Secp256k1::~Secp256k1() {
+    EC_GROUP_free(group_);
+    BN_CTX_free(ctx_);
+}
+
+// Q = r^-1 * (s * R - z * G), where R is the point with x = r and the
+// y parity carried in the top bit of s
+bool Secp256k1::recoverAddress(const uint8_t *digest, const uint8_t *signature,
+  uint8_t *address) {
+
+    uint8_t s[32];
+    for (int i = 0; i < 32; i++) { s[i] = signature[32 + i]; }
+    int yParity = s[0] >> 7;
+    s[0] &= 0x7f;
+
+    BN_CTX_start(ctx_);
+    BIGNUM *r = BN_CTX_get(ctx_);
+    BIGNUM *sn = BN_CTX_get(ctx_);
+    BIGNUM *z = BN_CTX_get(ctx_);
+    BIGNUM *rInv = BN_CTX_get(ctx_);
+    BIGNUM *u1 = BN_CTX_get(ctx_);
+    BIGNUM *u2 = BN_CTX_get(ctx_);
+
+    EC_POINT *R = EC_POINT_new(group_);
+    EC_POINT *Q = EC_POINT_new(group_);
+
+    bool valid = false;
+    const BIGNUM *order = EC_GROUP_get0_order(group_);
+
+    do {
+        if (u2 == NULL || R == NULL || Q == NULL) { break; }
+
+        BN_bin2bn(signature, 32, r);
+        BN_bin2bn(s, 32, sn);
+        BN_bin2bn(digest, 32, z);
+
+        if (BN_is_zero(r) || BN_cmp(r, order) >= 0) { break; }
+        if (BN_is_zero(sn) || BN_cmp(sn, order) >= 0) { break; }
+
+        if (!EC_POINT_set_compressed_coordinates(group_, R, r, yParity, ctx_)) {
+            break;
+        }
+
+        if (!BN_mod_inverse(rInv, r, order, ctx_)) { break; }
+
+        // u1 = -z / r, u2 = s / r
+        if (!BN_nnmod(z, z, order, ctx_)) { break; }
+        if (!BN_mod_sub(u1, order, z, order, ctx_)) { break; }
+        if (!BN_mod_mul(u1, u1, rInv, order, ctx_)) { break; }
+        if (!BN_mod_mul(u2, sn, rInv, order, ctx_)) { break; }
+
+        if (!EC_POINT_mul(group_, Q, u1, R, u2, ctx_)) { break; }
+        if (EC_POINT_is_at_infinity(group_, Q)) { break; }
+
+        uint8_t pubkey[65];
+        if (EC_POINT_point2oct(group_, Q, POINT_CONVERSION_UNCOMPRESSED,
+          pubkey, sizeof(pubkey), ctx_) != sizeof(pubkey)) {
+            break;
+        }
+
+        uint8_t hash[KECCAK256_DIGEST_LENGTH];
+        keccak256(&pubkey[1], 64, hash);
+        for (int i = 0; i < ADDRESS_LENGTH; i++) { address[i] = hash[12 + i]; }
+
+        valid = true;
+    } while (0);
+
+    EC_POINT_free(R);
+    EC_POINT_free(Q);
+    BN_CTX_end(ctx_);
+
+    return valid;
+}
+
+bool Secp256k1::recoverMessage(const std::string &message,
+  const uint8_t *signature, uint8_t *address) {
+
+    std::string prefixed = "\x19" "Ethereum Signed Message:\n";
+    prefixed += std::to_string(message.size());
+    prefixed += message;
+
+    uint8_t digest[KECCAK256_DIGEST_LENGTH];
+    keccak256((const uint8_t*)prefixed.data(), prefixed.size(), digest);
+
+    return recoverAddress(digest, signature, address);
+}
+
+}  // namespace pixie
@@ -0,0 +1,44 @@
+#ifndef __SECP256K1_H__
+#define __SECP256K1_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+typedef struct ec_group_st EC_GROUP;
+typedef struct bignum_ctx BN_CTX;
+
+
+namespace pixie {
+
+#define ADDRESS_LENGTH            (20)
+#define COMPACT_SIGNATURE_LENGTH  (64)
+
+// Recovers Ethereum signers on secp256k1. Instances are not thread-safe;
+// use one per thread.
+class Secp256k1 {
+  public:
+    Secp256k1();
+    ~Secp256k1();
+
+    Secp256k1(const Secp256k1&) = delete;
+    Secp256k1& operator=(const Secp256k1&) = delete;
+
+    // Recovers the address which signed the 32-byte digest, from a compact
+    // (EIP-2098) signature; returns false if the signature is invalid
+    bool recoverAddress(const uint8_t *digest, const uint8_t *signature,
+      uint8_t *address);
+
+    // The same for an EIP-191 message, as ethers' verifyMessage
+    bool recoverMessage(const std::string &message, const uint8_t *signature,
+      uint8_t *address);
+
+  private:
+    EC_GROUP *group_;
+    BN_CTX *ctx_;
+};
+
+}  // namespace pixie
+
+#endif /* __SECP256K1_H__ */
@@ -0,0 +1,210 @@
+#include "verifier.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <stdio.h>
+#include <string.h>
+
+#include "attest.h"
+#include "sha2.h"
+
+
+namespace pixie {
+
+// 0x70CD34d96E58876a25445dd75f54630D99258182
+const uint8_t PixieAuthority[ADDRESS_LENGTH] = {
+    0x70, 0xcd, 0x34, 0xd9, 0x6e, 0x58, 0x87, 0x6a, 0x25, 0x44,
+    0x5d, 0xd7, 0x5f, 0x54, 0x63, 0x0d, 0x99, 0x25, 0x81, 0x82
+};
+
+const char* verifyResultMessage(VerifyResult result) {
+    switch (result) {
+        case VerifyOk:
+            return "ok";
+        case VerifyBadVersion:
+            return "invalid attestation; unknown version";
+        case VerifyBadLength:
+            return "invalid attestation; bad length";
+        case VerifyBadAuthority:
+            return "invalid attestation; address not signing authority";
+        case VerifyBadModulus:
+            return "invalid attestation; unsupported modulus";
+        case VerifyBadSignature:
+            return "invalid attestion; signature did not match";
+    }
+    return "unknown error";
+}
+
+static uint32_t readUint32(const uint8_t *data) {
+    return ((uint32_t)data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+}
+
+Verifier::CachedModulus::CachedModulus(const uint8_t *n, size_t length,
+  LaneKernel kernel) : modulus(n, length) {
+
+    if (kernel != LaneKernelScalar) {
+        lanes.reset(new LaneModulus(modulus, kernel));
+    }
+}
+
+Verifier::Verifier(const uint8_t *authority, LaneKernel kernel) :
+  authority_((const char*)authority, ADDRESS_LENGTH), kernel_(kernel) {
+
+    if (!laneKernelSupported(kernel)) {
+        throw std::invalid_argument("lane kernel not supported by this CPU");
+    }
+}
+
+// The authority signs (EIP-191) the model, serial and pubkey N as hex
+bool Verifier::checkAuthority(const uint8_t *proof) {
+    std::string key((const char*)&proof[ATTEST_DEVICE_OFFSET], ATTEST_DEVICE_LENGTH);
+
+    auto cached = signers_.find(key);
+    if (cached != signers_.end()) { return cached->second == authority_; }
+
+    char message[64 + 2 * ATTEST_PUBKEYN_LENGTH];
+    int offset = snprintf(message, sizeof(message), "model=%08x serial=%08x pubkey=",
+      readUint32(&proof[ATTEST_MODEL_OFFSET]), readUint32(&proof[ATTEST_SERIAL_OFFSET]));
+    for (int i = 0; i < ATTEST_PUBKEYN_LENGTH; i++) {
+        offset += snprintf(&message[offset], sizeof(message) - offset, "%02x",
+          proof[ATTEST_PUBKEYN_OFFSET + i]);
+    }
+
+    uint8_t address[ADDRESS_LENGTH];
+    std::string signer;
+    if (secp256k1_.recoverMessage(std::string(message, offset),
+      &proof[ATTEST_AUTHORITY_OFFSET], address)) {
+        signer.assign((const char*)address, ADDRESS_LENGTH);
+    }
+
+    if (signers_.size() >= CacheSize) { signers_.clear(); }
+    signers_.emplace(key, signer);
+
+    return signer == authority_;
+}
+
+std::shared_ptr<Verifier::CachedModulus> Verifier::getModulus(const uint8_t *proof) {
+    std::string key((const char*)&proof[ATTEST_PUBKEYN_OFFSET], ATTEST_PUBKEYN_LENGTH);
+
+    auto cached = moduli_.find(key);
+    if (cached != moduli_.end()) { return cached->second; }
+
+    std::shared_ptr<CachedModulus> modulus;
+    try {
+        modulus = std::make_shared<CachedModulus>(&proof[ATTEST_PUBKEYN_OFFSET],
+          ATTEST_PUBKEYN_LENGTH, kernel_);
+    } catch (const std::invalid_argument &error) { }
+
+    if (moduli_.size() >= CacheSize) { moduli_.clear(); }
+    moduli_.emplace(key, modulus);
+
+    return modulus;
+}
+
+VerifyResult Verifier::prepare(const uint8_t *proof, size_t length,
+  std::shared_ptr<CachedModulus> &modulus, uint8_t *expected) {
+
+    if (length == 0 || proof[ATTEST_VERSION_OFFSET] != ATTEST_VERSION) {
+        return VerifyBadVersion;
+    }
+    if (length != ATTEST_LENGTH) { return VerifyBadLength; }
+
+    if (!checkAuthority(proof)) { return VerifyBadAuthority; }
+
+    // A valid signature for an even (or short) modulus could only come
+    // from a broken device; reject rather than fall back to BigInt
+    modulus = getModulus(proof);
+    if (!modulus) { return VerifyBadModulus; }
+
+    if (!modulus->modulus.reduced(&proof[ATTEST_SIGNATURE_OFFSET])) {
+        return VerifyBadSignature;
+    }
+
+    // The RSA result must be sha256 of everything preceding the signature
+    memset(expected, 0, ATTEST_SIGNATURE_LENGTH);
+    Sha256Context context;
+    sha2_initSha256(&context);
+    sha2_updateSha256(&context, proof, ATTEST_SIGNATURE_OFFSET);
+    sha2_finalSha256(&context, &expected[ATTEST_SIGNATURE_LENGTH - SHA256_DIGEST_SIZE]);
+
+    return VerifyOk;
+}
+
+VerifyResult Verifier::verify(const uint8_t *proof, size_t length,
+  ProofInfo *info) {
+
+    std::shared_ptr<CachedModulus> modulus;
+    uint8_t expected[ATTEST_SIGNATURE_LENGTH];
+
+    VerifyResult result = prepare(proof, length, modulus, expected);
+    if (result != VerifyOk) { return result; }
+
+    uint8_t computed[ATTEST_SIGNATURE_LENGTH];
+    modulus->modulus.powE(&proof[ATTEST_SIGNATURE_OFFSET], computed);
+    if (memcmp(computed, expected, ATTEST_SIGNATURE_LENGTH)) {
+        return VerifyBadSignature;
+    }
+
+    if (info) {
+        info->model = readUint32(&proof[ATTEST_MODEL_OFFSET]);
+        info->serial = readUint32(&proof[ATTEST_SERIAL_OFFSET]);
+    }
+
+    return VerifyOk;
+}
+
+void Verifier::verifyBatch(const uint8_t *const *proofs, const size_t *lengths,
+  size_t count, VerifyResult *results) {
+
+    if (kernel_ == LaneKernelScalar) {
+        for (size_t i = 0; i < count; i++) {
+            results[i] = verify(proofs[i], lengths[i]);
+        }
+        return;
+    }
+
+    struct Pending {
+        size_t index;
+        std::shared_ptr<CachedModulus> modulus;
+        uint8_t expected[ATTEST_SIGNATURE_LENGTH];
+        uint8_t computed[ATTEST_SIGNATURE_LENGTH];
+    };
+
+    std::vector<Pending> pending(count);
+    size_t pendingCount = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        Pending &job = pending[pendingCount];
+        results[i] = prepare(proofs[i], lengths[i], job.modulus, job.expected);
+        if (results[i] != VerifyOk) { continue; }
+        job.index = i;
+        pendingCount++;
+    }
+
+    const size_t width = laneKernelWidth(kernel_);
+
+    const LaneModulus *moduli[LANE_MAX_WIDTH];
+    const uint8_t *sigs[LANE_MAX_WIDTH];
+    uint8_t *computed[LANE_MAX_WIDTH];
+
+    for (size_t offset = 0; offset < pendingCount; offset += width) {
+        size_t lanes = std::min(width, pendingCount - offset);
+        for (size_t lane = 0; lane < lanes; lane++) {
+            Pending &job = pending[offset + lane];
+            moduli[lane] = job.modulus->lanes.get();
+            sigs[lane] = &proofs[job.index][ATTEST_SIGNATURE_OFFSET];
+            computed[lane] = job.computed;
+        }
+
+        powELanes(moduli, sigs, computed, lanes);
+
+        for (size_t lane = 0; lane < lanes; lane++) {
+            Pending &job = pending[offset + lane];
+            if (memcmp(job.computed, job.expected, ATTEST_SIGNATURE_LENGTH)) {
+                results[job.index] = VerifyBadSignature;
+            }
+        }
+    }
+}
+
+}  // namespace pixie
@@ -0,0 +1,96 @@
+#ifndef __VERIFIER_H__
+#define __VERIFIER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "lanes.h"
+#include "modulus.h"
+#include "secp256k1.h"
+
+
+namespace pixie {
+
+enum VerifyResult {
+    VerifyOk = 0,
+    VerifyBadVersion,
+    VerifyBadLength,
+    VerifyBadAuthority,
+    VerifyBadModulus,
+    VerifyBadSignature
+};
+
+// Matches the error messages of scripts/attest.mjs
+const char* verifyResultMessage(VerifyResult result);
+
+struct ProofInfo {
+    uint32_t model;
+    uint32_t serial;
+};
+
+// Verifies version 1 proofs (see main/attest.h), caching the recovered
+// authority per device block and the Montgomery context per modulus, so
+// repeat devices only pay for one RSA public operation. Instances are not
+// thread-safe; use one per thread.
+class Verifier {
+  public:
+    // Caches are cleared once they reach this many entries
+    static const size_t CacheSize = 4096;
+
+    // The expected signing authority (20 bytes); batches use the lane
+    // kernel (see lanes.h)
+    explicit Verifier(const uint8_t *authority,
+      LaneKernel kernel = laneKernelBest());
+
+    LaneKernel kernel() const { return kernel_; }
+
+    VerifyResult verify(const uint8_t *proof, size_t length,
+      ProofInfo *info = nullptr);
+
+    // Verifies count proofs, running the RSA checks through the lane
+    // kernel a full set of lanes at a time
+    void verifyBatch(const uint8_t *const *proofs, const size_t *lengths,
+      size_t count, VerifyResult *results);
+
+    size_t cachedDevices() const { return signers_.size(); }
+    size_t cachedModuli() const { return moduli_.size(); }
+
+  private:
+    struct CachedModulus {
+        CachedModulus(const uint8_t *n, size_t length, LaneKernel kernel);
+
+        Modulus modulus;
+
+        // Null for the scalar kernel
+        std::unique_ptr<LaneModulus> lanes;
+    };
+
+    std::string authority_;
+    LaneKernel kernel_;
+    Secp256k1 secp256k1_;
+
+    // Device block -> recovered signer address
+    std::unordered_map<std::string, std::string> signers_;
+
+    // Pubkey N -> Montgomery contexts (null if the modulus is unusable)
+    std::unordered_map<std::string, std::shared_ptr<CachedModulus>> moduli_;
+
+    bool checkAuthority(const uint8_t *proof);
+    std::shared_ptr<CachedModulus> getModulus(const uint8_t *proof);
+
+    // Everything except the RSA operation; on success, sets the modulus
+    // and the expected RSA result
+    VerifyResult prepare(const uint8_t *proof, size_t length,
+      std::shared_ptr<CachedModulus> &modulus, uint8_t *expected);
+};
+
+// The production signing authority (see scripts/attest.mjs)
+extern const uint8_t PixieAuthority[ADDRESS_LENGTH];
+
+}  // namespace pixie
+
+#endif /* __VERIFIER_H__ */
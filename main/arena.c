@@ -0,0 +1,132 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "arena.h"
+
+#include "esp_heap_caps.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "mbedtls/platform.h"
+#include "mbedtls/platform_util.h"
+
+
+// Size classes are 16, 32, ..., 4096 bytes
+#define CLASS_COUNT    (9)
+#define CLASS_MIN      (16)
+
+// Each block is prefixed with its size class; 8 bytes keeps the
+// payload aligned
+#define HEADER_SIZE    (8)
+
+
+typedef struct FreeBlock {
+    struct FreeBlock *next;
+} FreeBlock;
+
+typedef struct Arena {
+    TaskHandle_t owner;
+
+    uint8_t *base;
+    size_t size;
+    size_t offset;
+
+    FreeBlock *freeList[CLASS_COUNT];
+
+    size_t fallbacks;
+} Arena;
+
+static Arena arena = { 0 };
+
+
+static bool contains(void *ptr) {
+    return ((uint8_t*)ptr >= arena.base && (uint8_t*)ptr < arena.base + arena.size);
+}
+
+static void* arenaCalloc(size_t count, size_t size) {
+    if (count && size > SIZE_MAX / count) { return NULL; }
+    size_t length = count * size;
+
+    if (xTaskGetCurrentTaskHandle() == arena.owner) {
+        int index = 0;
+        while (index < CLASS_COUNT && (CLASS_MIN << index) < length) { index++; }
+
+        if (index < CLASS_COUNT) {
+            uint8_t *ptr = NULL;
+
+            if (arena.freeList[index]) {
+                ptr = (uint8_t*)arena.freeList[index];
+                arena.freeList[index] = arena.freeList[index]->next;
+
+            } else if (arena.offset + HEADER_SIZE + (CLASS_MIN << index) <= arena.size) {
+                uint8_t *block = &arena.base[arena.offset];
+                arena.offset += HEADER_SIZE + (CLASS_MIN << index);
+
+                *(uint32_t*)block = index;
+                ptr = &block[HEADER_SIZE];
+            }
+
+            if (ptr) {
+                memset(ptr, 0, length);
+                return ptr;
+            }
+        }
+
+        arena.fallbacks++;
+    }
+
+    return MBEDTLS_PLATFORM_STD_CALLOC(count, size);
+}
+
+static void arenaFree(void *ptr) {
+    if (ptr == NULL) { return; }
+
+    if (!contains(ptr)) {
+        MBEDTLS_PLATFORM_STD_FREE(ptr);
+        return;
+    }
+
+    uint32_t index = *(uint32_t*)((uint8_t*)ptr - HEADER_SIZE);
+
+    // Scrub it now; mbedtls does not always zeroize before freeing
+    mbedtls_platform_zeroize(ptr, CLASS_MIN << index);
+
+    FreeBlock *block = ptr;
+    block->next = arena.freeList[index];
+    arena.freeList[index] = block;
+}
+
+int arena_begin(size_t size) {
+    if (arena.base) { return -1; }
+
+    uint8_t *base = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (base == NULL) { return -2; }
+
+    memset(&arena, 0, sizeof(Arena));
+    arena.owner = xTaskGetCurrentTaskHandle();
+    arena.base = base;
+    arena.size = size;
+
+    mbedtls_platform_set_calloc_free(arenaCalloc, arenaFree);
+
+    return 0;
+}
+
+void arena_end(ArenaStats *stats) {
+    if (arena.base == NULL) { return; }
+
+    mbedtls_platform_set_calloc_free(MBEDTLS_PLATFORM_STD_CALLOC,
+      MBEDTLS_PLATFORM_STD_FREE);
+
+    if (stats) {
+        stats->size = arena.size;
+        stats->highWater = arena.offset;
+        stats->fallbacks = arena.fallbacks;
+    }
+
+    mbedtls_platform_zeroize(arena.base, arena.size);
+    heap_caps_free(arena.base);
+
+    memset(&arena, 0, sizeof(Arena));
+}
@@ -0,0 +1,39 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// An arena for mbedtls allocations during a single operation (such as
+// GEN-KEY). While active, all mbedtls allocations made by the calling
+// task are served from size-class free lists within one block, which
+// is zeroized and released in one step by arena_end.
+//
+// Allocations from other tasks, or which do not fit, fall back to the
+// default mbedtls allocator.
+
+typedef struct ArenaStats {
+    size_t size;
+
+    // The most bytes ever bumped from the arena; use this to size it
+    size_t highWater;
+
+    // Allocations which did not fit in the arena
+    size_t fallbacks;
+} ArenaStats;
+
+
+int arena_begin(size_t size);
+void arena_end(ArenaStats *stats);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ARENA_H__ */
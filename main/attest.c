@@ -0,0 +1,68 @@
+#include <string.h>
+
+#include "attest.h"
+
+#include "esp_random.h"
+
+#include "sha2.h"
+#include "utils.h"
+
+
+static uint8_t template[ATTEST_LENGTH] = { ATTEST_VERSION };
+static uint8_t compactTemplate[ATTEST_COMPACT_LENGTH] = { ATTEST_COMPACT_VERSION };
+
+
+static void writeUint32(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xff;
+    data[1] = (value >> 16) & 0xff;
+    data[2] = (value >> 8) & 0xff;
+    data[3] = (value >> 0) & 0xff;
+}
+
+void attest_setDevice(uint32_t modelNumber, uint32_t serialNumber,
+  const uint8_t *pubkeyN, const uint8_t *authority) {
+
+    writeUint32(&template[ATTEST_MODEL_OFFSET], modelNumber);
+    writeUint32(&template[ATTEST_SERIAL_OFFSET], serialNumber);
+    memcpy(&template[ATTEST_PUBKEYN_OFFSET], pubkeyN, ATTEST_PUBKEYN_LENGTH);
+    memcpy(&template[ATTEST_AUTHORITY_OFFSET], authority, ATTEST_AUTHORITY_LENGTH);
+
+    writeUint32(&compactTemplate[ATTEST_MODEL_OFFSET], modelNumber);
+    writeUint32(&compactTemplate[ATTEST_SERIAL_OFFSET], serialNumber);
+
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, pubkeyN, ATTEST_PUBKEYN_LENGTH);
+    sha2_finalSha256(&ctx, &compactTemplate[ATTEST_COMPACT_KEYID_OFFSET]);
+}
+
+uint8_t* attest_template() {
+    return template;
+}
+
+static void prepare(uint8_t *data, size_t length, const uint8_t *challenge,
+  uint8_t *message) {
+
+    esp_fill_random(&data[ATTEST_NONCE_OFFSET], ATTEST_NONCE_LENGTH);
+    memcpy(&data[ATTEST_CHALLENGE_OFFSET], challenge, ATTEST_CHALLENGE_LENGTH);
+
+    memset(message, 0, ATTEST_SIGNATURE_LENGTH);
+
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, data, length);
+    sha2_finalSha256(&ctx, message);
+    reverseBytes(message, SHA256_DIGEST_SIZE);
+}
+
+void attest_prepare(const uint8_t *challenge, uint8_t *message) {
+    prepare(template, ATTEST_SIGNATURE_OFFSET, challenge, message);
+}
+
+uint8_t* attest_compactTemplate() {
+    return compactTemplate;
+}
+
+void attest_prepareCompact(const uint8_t *challenge, uint8_t *message) {
+    prepare(compactTemplate, ATTEST_COMPACT_SIGNATURE_OFFSET, challenge, message);
+}
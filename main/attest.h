@@ -0,0 +1,131 @@
+#ifndef __ATTEST_H__
+#define __ATTEST_H__
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// Compile-time layout checks, which also work when the header is
+// included by C++ host tools
+#ifdef __cplusplus
+#define ATTEST_STATIC_ASSERT(cond, message)   static_assert(cond, message)
+#else
+#define ATTEST_STATIC_ASSERT(cond, message)   _Static_assert(cond, message)
+#endif /* __cplusplus */
+
+
+// The layout of a version 1 attestation (ATTEST); this header has no
+// device dependencies, so host tools include it directly, and the scripts
+// use offsets generated from it (see scripts/build-layout.mjs).
+//
+// The signature is over sha256 of everything preceding it, and the
+// device block (model through authority) is also used by ATTEST-N and
+// ATTEST-MERKLE.
+
+#define ATTEST_VERSION               (0x01)
+
+#define ATTEST_VERSION_OFFSET        (0)
+#define ATTEST_NONCE_OFFSET          (1)
+#define ATTEST_NONCE_LENGTH          (7)
+#define ATTEST_CHALLENGE_OFFSET      (ATTEST_NONCE_OFFSET + ATTEST_NONCE_LENGTH)
+#define ATTEST_CHALLENGE_LENGTH      (8)
+
+#define ATTEST_DEVICE_OFFSET         (ATTEST_CHALLENGE_OFFSET + ATTEST_CHALLENGE_LENGTH)
+#define ATTEST_MODEL_OFFSET          (ATTEST_DEVICE_OFFSET)
+#define ATTEST_SERIAL_OFFSET         (ATTEST_MODEL_OFFSET + 4)
+#define ATTEST_PUBKEYN_OFFSET        (ATTEST_SERIAL_OFFSET + 4)
+#define ATTEST_PUBKEYN_LENGTH        (384)
+#define ATTEST_AUTHORITY_OFFSET      (ATTEST_PUBKEYN_OFFSET + ATTEST_PUBKEYN_LENGTH)
+#define ATTEST_AUTHORITY_LENGTH      (64)
+#define ATTEST_DEVICE_LENGTH         (ATTEST_AUTHORITY_OFFSET + ATTEST_AUTHORITY_LENGTH - ATTEST_DEVICE_OFFSET)
+
+#define ATTEST_SIGNATURE_OFFSET      (ATTEST_AUTHORITY_OFFSET + ATTEST_AUTHORITY_LENGTH)
+#define ATTEST_SIGNATURE_LENGTH      (384)
+
+#define ATTEST_LENGTH                (ATTEST_SIGNATURE_OFFSET + ATTEST_SIGNATURE_LENGTH)
+
+ATTEST_STATIC_ASSERT(ATTEST_CHALLENGE_OFFSET == 8, "challenge offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_DEVICE_OFFSET == 16, "device offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_DEVICE_LENGTH == 456, "device length changed");
+ATTEST_STATIC_ASSERT(ATTEST_SIGNATURE_OFFSET == 472, "signature offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_LENGTH == 856, "attestation length changed");
+
+
+// The layout of a version 3 attestation (ATTEST-COMPACT); identical to
+// version 1 up to the serial number, but the pubkey N and authority are
+// replaced by the key ID, sha256(pubkey N), which verifiers resolve from
+// full proofs they have already seen.
+
+#define ATTEST_COMPACT_VERSION              (0x03)
+
+#define ATTEST_COMPACT_KEYID_OFFSET         (ATTEST_SERIAL_OFFSET + 4)
+#define ATTEST_COMPACT_KEYID_LENGTH         (32)
+
+#define ATTEST_COMPACT_SIGNATURE_OFFSET     (ATTEST_COMPACT_KEYID_OFFSET + ATTEST_COMPACT_KEYID_LENGTH)
+
+#define ATTEST_COMPACT_LENGTH               (ATTEST_COMPACT_SIGNATURE_OFFSET + ATTEST_SIGNATURE_LENGTH)
+
+ATTEST_STATIC_ASSERT(ATTEST_COMPACT_SIGNATURE_OFFSET == 56, "compact signature offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_COMPACT_LENGTH == 440, "compact attestation length changed");
+
+
+// The layout of a version 2 attestation (ATTEST-MERKLE); the challenge
+// is replaced by the leaf count and the root of the tree over all the
+// challenges, followed by the same device block and signature as
+// version 1. The inclusion paths are output separately.
+
+#define ATTEST_MERKLE_VERSION               (0x02)
+
+#define ATTEST_MERKLE_COUNT_OFFSET          (ATTEST_NONCE_OFFSET + ATTEST_NONCE_LENGTH)
+#define ATTEST_MERKLE_COUNT_LENGTH          (4)
+#define ATTEST_MERKLE_ROOT_OFFSET           (ATTEST_MERKLE_COUNT_OFFSET + ATTEST_MERKLE_COUNT_LENGTH)
+#define ATTEST_MERKLE_ROOT_LENGTH           (32)
+
+#define ATTEST_MERKLE_DEVICE_OFFSET         (ATTEST_MERKLE_ROOT_OFFSET + ATTEST_MERKLE_ROOT_LENGTH)
+#define ATTEST_MERKLE_MODEL_OFFSET          (ATTEST_MERKLE_DEVICE_OFFSET)
+#define ATTEST_MERKLE_SERIAL_OFFSET         (ATTEST_MERKLE_MODEL_OFFSET + 4)
+#define ATTEST_MERKLE_PUBKEYN_OFFSET        (ATTEST_MERKLE_SERIAL_OFFSET + 4)
+#define ATTEST_MERKLE_AUTHORITY_OFFSET      (ATTEST_MERKLE_PUBKEYN_OFFSET + ATTEST_PUBKEYN_LENGTH)
+
+#define ATTEST_MERKLE_SIGNATURE_OFFSET      (ATTEST_MERKLE_DEVICE_OFFSET + ATTEST_DEVICE_LENGTH)
+
+#define ATTEST_MERKLE_LENGTH                (ATTEST_MERKLE_SIGNATURE_OFFSET + ATTEST_SIGNATURE_LENGTH)
+
+ATTEST_STATIC_ASSERT(ATTEST_MERKLE_ROOT_OFFSET == 12, "merkle root offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_MERKLE_DEVICE_OFFSET == 44, "merkle device offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_MERKLE_AUTHORITY_OFFSET + ATTEST_AUTHORITY_LENGTH ==
+  ATTEST_MERKLE_SIGNATURE_OFFSET, "merkle device block changed");
+ATTEST_STATIC_ASSERT(ATTEST_MERKLE_SIGNATURE_OFFSET == 500, "merkle signature offset changed");
+ATTEST_STATIC_ASSERT(ATTEST_MERKLE_LENGTH == 884, "merkle attestation length changed");
+
+
+// Updates the persistent template; call whenever the model number,
+// serial number, pubkey N or authority attest change
+void attest_setDevice(uint32_t modelNumber, uint32_t serialNumber,
+  const uint8_t *pubkeyN, const uint8_t *authority);
+
+// The persistent template (ATTEST_LENGTH bytes); the version and device
+// block are always populated, so only the nonce, challenge and signature
+// need to be written for each attestation
+uint8_t* attest_template();
+
+// Fills in the nonce and challenge, and computes the message to sign
+// (ATTEST_SIGNATURE_LENGTH bytes; little-endian, as the DS expects)
+void attest_prepare(const uint8_t *challenge, uint8_t *message);
+
+// The compact template (ATTEST_COMPACT_LENGTH bytes), which is kept in
+// sync with the full template by attest_setDevice
+uint8_t* attest_compactTemplate();
+
+// Same as attest_prepare, for the compact template
+void attest_prepareCompact(const uint8_t *challenge, uint8_t *message);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ATTEST_H__ */
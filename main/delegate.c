@@ -0,0 +1,151 @@
+#include <string.h>
+
+#include "delegate.h"
+
+#include "esp_random.h"
+
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/ecdsa.h"
+#include "mbedtls/entropy.h"
+
+#include "sha2.h"
+#include "signer.h"
+#include "utils.h"
+
+
+typedef struct Delegate {
+    bool ready;
+
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+
+    mbedtls_ecp_group grp;
+    mbedtls_mpi d;
+    mbedtls_ecp_point Q;
+
+    uint8_t certificate[DELEGATE_CERT_LENGTH];
+} Delegate;
+
+static Delegate delegate = { 0 };
+
+
+static int generate() {
+    const char *personal = "pixie-delegate";
+    int ret = mbedtls_ctr_drbg_seed(&delegate.ctr_drbg, mbedtls_entropy_func,
+      &delegate.entropy, (const uint8_t*)personal, strlen(personal));
+    if (ret) { return ret; }
+
+    ret = mbedtls_ecp_group_load(&delegate.grp, MBEDTLS_ECP_DP_SECP256R1);
+    if (ret) { return ret; }
+
+    ret = mbedtls_ecp_gen_keypair(&delegate.grp, &delegate.d, &delegate.Q,
+      mbedtls_ctr_drbg_random, &delegate.ctr_drbg);
+    if (ret) { return ret; }
+
+    uint8_t *cert = delegate.certificate;
+    memset(cert, 0, DELEGATE_CERT_LENGTH);
+
+    cert[0] = DELEGATE_CERT_VERSION;
+    esp_fill_random(&cert[ATTEST_NONCE_OFFSET], ATTEST_NONCE_LENGTH);
+
+    size_t olen = 0;
+    ret = mbedtls_ecp_point_write_binary(&delegate.grp, &delegate.Q,
+      MBEDTLS_ECP_PF_UNCOMPRESSED, &olen, &cert[DELEGATE_PUBKEY_OFFSET],
+      DELEGATE_PUBKEY_LENGTH);
+    if (ret) { return ret; }
+    if (olen != DELEGATE_PUBKEY_LENGTH) { return -1; }
+
+    memcpy(&cert[DELEGATE_DEVICE_OFFSET], &attest_template()[ATTEST_DEVICE_OFFSET],
+      ATTEST_DEVICE_LENGTH);
+
+    uint8_t message[ATTEST_SIGNATURE_LENGTH] = { 0 };
+
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, cert, DELEGATE_CERT_SIGNATURE_OFFSET);
+    sha2_finalSha256(&ctx, message);
+    reverseBytes(message, SHA256_DIGEST_SIZE);
+
+    ret = signer_sign(message, &cert[DELEGATE_CERT_SIGNATURE_OFFSET]);
+    if (ret) { return ret; }
+
+    reverseBytes(&cert[DELEGATE_CERT_SIGNATURE_OFFSET], ATTEST_SIGNATURE_LENGTH);
+
+    return 0;
+}
+
+int delegate_begin() {
+    delegate_end();
+
+    mbedtls_entropy_init(&delegate.entropy);
+    mbedtls_ctr_drbg_init(&delegate.ctr_drbg);
+    mbedtls_ecp_group_init(&delegate.grp);
+    mbedtls_mpi_init(&delegate.d);
+    mbedtls_ecp_point_init(&delegate.Q);
+
+    // Marked ready first, so delegate_end releases everything on failure
+    delegate.ready = true;
+
+    int ret = generate();
+    if (ret) { delegate_end(); }
+
+    return ret;
+}
+
+void delegate_end() {
+    if (!delegate.ready) { return; }
+
+    mbedtls_ecp_point_free(&delegate.Q);
+    mbedtls_mpi_free(&delegate.d);
+    mbedtls_ecp_group_free(&delegate.grp);
+    mbedtls_ctr_drbg_free(&delegate.ctr_drbg);
+    mbedtls_entropy_free(&delegate.entropy);
+
+    memset(&delegate, 0, sizeof(Delegate));
+}
+
+bool delegate_ready() {
+    return delegate.ready;
+}
+
+const uint8_t* delegate_certificate() {
+    if (!delegate.ready) { return NULL; }
+    return delegate.certificate;
+}
+
+int delegate_sign(const uint8_t *challenge, uint8_t *item) {
+    if (!delegate.ready) { return -1; }
+
+    esp_fill_random(item, ATTEST_NONCE_LENGTH);
+    memcpy(&item[ATTEST_NONCE_LENGTH], challenge, ATTEST_CHALLENGE_LENGTH);
+
+    uint8_t version = DELEGATE_ITEM_VERSION;
+
+    uint8_t hash[SHA256_DIGEST_SIZE];
+
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, &version, 1);
+    sha2_updateSha256(&ctx, item, DELEGATE_SIGNATURE_OFFSET);
+    sha2_finalSha256(&ctx, hash);
+
+    mbedtls_mpi r, s;
+    mbedtls_mpi_init(&r);
+    mbedtls_mpi_init(&s);
+
+    int ret = mbedtls_ecdsa_sign(&delegate.grp, &r, &s, &delegate.d, hash,
+      sizeof(hash), mbedtls_ctr_drbg_random, &delegate.ctr_drbg);
+
+    if (ret == 0) {
+        ret = mbedtls_mpi_write_binary(&r, &item[DELEGATE_SIGNATURE_OFFSET], 32);
+    }
+
+    if (ret == 0) {
+        ret = mbedtls_mpi_write_binary(&s, &item[DELEGATE_SIGNATURE_OFFSET + 32], 32);
+    }
+
+    mbedtls_mpi_free(&r);
+    mbedtls_mpi_free(&s);
+
+    return ret;
+}
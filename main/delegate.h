@@ -0,0 +1,68 @@
+#ifndef __DELEGATE_H__
+#define __DELEGATE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "attest.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// A per-boot P-256 session key, delegated by the DS key. The DS key signs
+// a certificate over the session public key once, after which each
+// challenge is signed in software (ATTEST-SESSION).
+//
+// The certificate (version 4) is:
+//   0x04 || nonce || session pubkey || device block || signature
+// where the signature is the DS signature over sha256 of everything
+// preceding it, as in version 1.
+//
+// Each item is:
+//   nonce || challenge || r || s
+// where (r, s) is the P-256 ECDSA signature over
+// sha256(0x05 || nonce || challenge).
+
+#define DELEGATE_CERT_VERSION               (0x04)
+#define DELEGATE_ITEM_VERSION               (0x05)
+
+#define DELEGATE_PUBKEY_OFFSET              (ATTEST_NONCE_OFFSET + ATTEST_NONCE_LENGTH)
+#define DELEGATE_PUBKEY_LENGTH              (65)
+#define DELEGATE_DEVICE_OFFSET              (DELEGATE_PUBKEY_OFFSET + DELEGATE_PUBKEY_LENGTH)
+#define DELEGATE_CERT_SIGNATURE_OFFSET      (DELEGATE_DEVICE_OFFSET + ATTEST_DEVICE_LENGTH)
+#define DELEGATE_CERT_LENGTH                (DELEGATE_CERT_SIGNATURE_OFFSET + ATTEST_SIGNATURE_LENGTH)
+
+#define DELEGATE_SIGNATURE_OFFSET           (ATTEST_NONCE_LENGTH + ATTEST_CHALLENGE_LENGTH)
+#define DELEGATE_SIGNATURE_LENGTH           (64)
+#define DELEGATE_ITEM_LENGTH                (DELEGATE_SIGNATURE_OFFSET + DELEGATE_SIGNATURE_LENGTH)
+
+ATTEST_STATIC_ASSERT(DELEGATE_CERT_SIGNATURE_OFFSET == 529, "certificate signature offset changed");
+ATTEST_STATIC_ASSERT(DELEGATE_CERT_LENGTH == 913, "certificate length changed");
+ATTEST_STATIC_ASSERT(DELEGATE_ITEM_LENGTH == 79, "item length changed");
+
+
+// Generates a new session key and signs its certificate with the DS key,
+// over the current device block (see attest_setDevice)
+int delegate_begin();
+
+// Discards the session key; call whenever the device block or cipherdata
+// change, since the certificate would no longer match
+void delegate_end();
+
+bool delegate_ready();
+
+// The certificate (DELEGATE_CERT_LENGTH bytes), if ready
+const uint8_t* delegate_certificate();
+
+// Signs the challenge (ATTEST_CHALLENGE_LENGTH bytes) with the session
+// key, filling item (DELEGATE_ITEM_LENGTH bytes)
+int delegate_sign(const uint8_t *challenge, uint8_t *item);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __DELEGATE_H__ */
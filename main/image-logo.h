@@ -1,710 +1,251 @@
-#ifndef __IMAGE_logo_H__
-#define __IMAGE_logo_H__
+#ifndef __IMAGE_LOGO_H__
+#define __IMAGE_LOGO_H__
+
+// Generated by scripts/image.mjs; do not edit
 
 #ifdef __cplusplus
 extern "C" {
 #endif  /* __cplusplus */
 #include <stdint.h>
 
+// See main/image.h for the format
 const uint16_t image_logo[] = {
-  0x0104, 0x004d, 0x0048, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xcf83, 0x99de,
-  0xbdff, 0x1be7, 0xf3a4, 0x8a52, 0xe418, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x8a52, 0x9df7, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xb6bd, 0x0c63, 0x2421, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x294a, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xd6c5, 0xec62, 0x0421, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x6208, 0x1be7, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xb6bd, 0xaa5a, 0xa310, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x294a, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x7cf7,
-  0xe841, 0x0421, 0xcf83, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x9dff, 0xb29c, 0xe841, 0x4108, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1084, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xd29c, 0x0000, 0x0000, 0x2000,
-  0xd29c, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x1be7, 0xae7b, 0x6629, 0x2000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x58ce, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xf3a4, 0x0000, 0x0000, 0x0000, 0x0842, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x37ce, 0xec62, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa310, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x0421,
-  0x0000, 0x0000, 0xe841, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xb29c, 0xc739, 0x2108, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xe741, 0xbdff, 0xbdff, 0x99de, 0x8a52, 0x6d73, 0x7df7,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x99de, 0x694a, 0xc739, 0xf7c5,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x99de, 0x0c63, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4d6b, 0xbdff,
-  0xbdff, 0x0842, 0x0000, 0x0000, 0xa739, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xb29c, 0xc739, 0x2108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xf3a4, 0xbdff, 0xbdff, 0x8631, 0x0000,
-  0x0000, 0x0000, 0x95bd, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x99de,
-  0x0c63, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000,
-  0x1be7, 0xbdff, 0xbdff, 0xae7b, 0x0000, 0x0000, 0x0000, 0x7194,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x9df7, 0x518c,
-  0x6631, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xe420, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x8a52, 0x4108, 0x4529, 0x3bef, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xb6bd, 0x494a,
-  0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0842, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x1be7, 0x4d6b, 0xe418,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c6b, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xb29c, 0xa631, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x929c, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xd6c5, 0x494a, 0x4108, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x58ce, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xdae6, 0x0c6b, 0xa318, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6208, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x7df7, 0x1084, 0x4529, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4529, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x13a5, 0xc739, 0x2000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x494a, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xf7c5, 0x494a, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x6d73, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbade, 0xeb62, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd3a4, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x5cef,
-  0x6d73, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb9de, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x9df7, 0x1084,
-  0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x8210, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x9dff, 0xfbe6, 0xfbe6, 0xfbe6, 0xfbe6,
-  0x79d6, 0x38ce, 0x38ce, 0x38ce, 0x17c6, 0x95b5, 0x95b5, 0x95b5,
-  0x95b5, 0x13a5, 0xf3a4, 0xf3a4, 0xf3a4, 0xd29c, 0x5194, 0x5194,
-  0x5194, 0x5194, 0xef83, 0xcf7b, 0xcf7b, 0xcf7b, 0xc739, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6629, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x79d6, 0x6631, 0x6629, 0x6629, 0x6529, 0x0421,
-  0x0421, 0x0421, 0x0421, 0xe418, 0xc318, 0xc318, 0xc318, 0xc318,
-  0x6208, 0x6208, 0x6208, 0x6208, 0x2108, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x294a, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xe841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0c6b, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xd3a4, 0x0000, 0x0000, 0xa318, 0x0421,
-  0x0421, 0x0421, 0x0421, 0x2529, 0x6629, 0x4108, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xa739, 0x2842, 0x2842, 0x2842, 0x294a, 0x8a52,
-  0x8a52, 0x8a52, 0x8a52, 0xaa5a, 0xeb62, 0xeb62, 0xcb5a, 0x4108,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x308c, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x9df7,
-  0x0421, 0x0000, 0x6208, 0x99de, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x2529, 0x0000, 0x0000, 0x0000, 0x0000, 0x6952,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x8a52, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x95bd, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x4d6b, 0x0000, 0x0000, 0x6d73,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x6629,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xbade, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x308c,
-  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3bef,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x99d6, 0x6108, 0x0000, 0x0421, 0x9df7, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x6629, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6d73, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xb6bd, 0x6108, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xa310, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x0842, 0x0000, 0x2000,
-  0x13a5, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x6629, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x1be7,
-  0xe418, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6629, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xf3a4, 0x2000, 0x0000, 0x0842, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x5194, 0xbdff, 0xc739, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xa739, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x294a, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x9df7, 0x0421, 0x0000,
-  0x0000, 0x6629, 0x7cf7, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x0421, 0xf7c5, 0xab5a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xe418, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xae7b, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0c6b, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x6d73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842,
-  0x9dff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x2521, 0xa310,
-  0xaa5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6210, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x9dff,
-  0xbade, 0xf7c5, 0x95b5, 0xf3a4, 0x7194, 0x308c, 0xcf7b, 0x2c6b,
-  0x8631, 0x4108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x308c,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x99de, 0x6208,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe841, 0x7cf7, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x294a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x8210, 0xa739, 0x0000, 0x1be7, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x38ce, 0xef83, 0x494a, 0xe420, 0x2000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x55b5, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4529, 0x79d6, 0xbdff, 0xbdff, 0xbdff,
-  0x508c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0xdae6,
-  0xe418, 0x54ad, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x3bef, 0x518c, 0x494a, 0xc318, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xbade, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x13a5,
-  0x2000, 0x0000, 0x6629, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x8210, 0xcf83, 0xbdff, 0xbdff, 0x7cf7, 0xa310, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xa631, 0xbdff, 0x79d6, 0x9194, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xf3a4, 0x6108, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x9df7, 0x0421, 0x0000, 0x4108, 0xf7c5,
-  0x2521, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2421, 0xef83, 0x1bef, 0x8e7b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2842, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x95bd, 0x6529, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0421, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x6d73, 0x0000, 0x0000, 0xab5a, 0xbdff, 0x6e73, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108,
-  0x2529, 0x2108, 0x0000, 0x0000, 0x0000, 0x494a, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x308c, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa631,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xb9de, 0x6210, 0x0000, 0xa318,
-  0x3bef, 0xbdff, 0x7cf7, 0xe420, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2842, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x108c, 0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x494a, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x294a, 0x0000, 0x0000, 0x108c, 0xbdff, 0xbdff, 0xbdff,
-  0x95b5, 0x6108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc739,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x108c, 0x2521, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2c6b, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x34ad, 0x2000, 0x0000,
-  0x6631, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xd3a4, 0x6108,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2521, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x13a5,
-  0xc739, 0x2108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x108c, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x9dff, 0x2421, 0x0000, 0x2108, 0xb6bd, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x96bd, 0xe420, 0x0000, 0x0000,
-  0x0000, 0x8e73, 0xae7b, 0x2108, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2108, 0x3cef, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x38ce, 0xaa5a,
-  0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x34ad, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x8e73, 0x0000,
-  0x0000, 0x8a52, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x5cef, 0xec62, 0x4108, 0x0000, 0xe739, 0xbdff,
-  0x13ad, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7194,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x58d6, 0xaa5a, 0x2842,
-  0xc739, 0xc739, 0xc739, 0xc739, 0x294a, 0x8a52, 0x0c63, 0xcf83,
-  0xb29c, 0xd6c5, 0x1bef, 0xbdff, 0xbdff, 0x5cf7, 0xef83, 0x6529,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x99d6, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbade, 0x8210, 0x0000, 0x8210, 0x1be7, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x99de, 0xab5a, 0xa210, 0xd29c, 0xbdff, 0x5cef, 0x0c6b,
-  0xa310, 0x0000, 0x0000, 0x0000, 0x8631, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6208, 0x0421, 0xc739, 0xab5a, 0xae7b, 0x6d73, 0xc739, 0x6208,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2108, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x294a,
-  0x0000, 0x0000, 0xcf83, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x9dff, 0x95bd, 0xbdff, 0xbdff, 0xbdff, 0x7cf7, 0x7194, 0x8a52,
-  0x8631, 0x4529, 0x95bd, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x7cf7, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xc318, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x54ad, 0x2000, 0x0000, 0x4529, 0xbdff,
-  0x9df7, 0x99d6, 0x55b5, 0x9194, 0x8e7b, 0x8e73, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x7cf7, 0x5cef, 0xbdff, 0xbdff, 0xfae6, 0x0421,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x2521, 0x0000, 0x0000, 0xa310, 0xa210, 0x2000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6d73, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x7cf7,
-  0xc318, 0x8e73, 0x9df7, 0xbdff, 0x58d6, 0xa318, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xe841, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x8e7b, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe420, 0x9df7,
-  0xbdff, 0xbdff, 0xf3a4, 0xd6c5, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x2529, 0x0000, 0xe420,
-  0x929c, 0xbdff, 0xf7c5, 0xa318, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x8a52, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xdae6, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x929c, 0xbdff, 0xbdff, 0xae7b, 0x2108,
-  0x9194, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x9dff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xaa5a, 0x0000, 0x0000, 0x0000, 0xa631, 0x37ce,
-  0xd6c5, 0x8210, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d6b, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x494a, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa631,
-  0xbdff, 0xbdff, 0xcb62, 0x0000, 0x0000, 0xef83, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x54ad,
-  0x494a, 0x7df7, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xd3a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x0c63, 0x75b5, 0x8210,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x108c, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x55b5, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2108, 0xf7c5, 0x9dff, 0x294a, 0x0000,
-  0x0000, 0x0000, 0xcf7b, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff,
-  0x58ce, 0x0c63, 0xbdff, 0xbdff, 0x5194, 0x0000, 0xa631, 0x3cef,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x9dff, 0x8210, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xe420, 0x2c6b, 0x6208, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34ad,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x4529, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xaa5a, 0x7cf7, 0xe841, 0x0000, 0x0000, 0x0000, 0x0000, 0xcf83,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xa739, 0xe418, 0xbdff,
-  0xbdff, 0x8e73, 0x0000, 0x0000, 0x6631, 0x3cef, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0x494a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x17ce, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xae7b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xa318, 0xbade, 0xa739, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5194, 0xbdff, 0xbdff, 0xbdff,
-  0xbdff, 0x929c, 0x0000, 0x0000, 0xd6c5, 0xbdff, 0x0c6b, 0x0000,
-  0x0000, 0x0000, 0x8631, 0x7cf7, 0xbdff, 0xbdff, 0xbdff, 0xd29c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x5cf7, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0xfae6, 0x8210,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xcf83, 0x6631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xd3a4, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x0421, 0x0000,
-  0x0000, 0x6d73, 0xbdff, 0xab5a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe739, 0xbdff, 0xbdff, 0xbdff, 0x9dff, 0x8210, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6210, 0xbdff, 0xbdff,
-  0xbdff, 0xbdff, 0xbdff, 0x694a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0x4529, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x54ad, 0xbdff,
-  0xbdff, 0xbdff, 0x108c, 0x0000, 0x0000, 0x0000, 0xa739, 0xbdff,
-  0x8a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8a52, 0xbdff,
-  0xbdff, 0xbdff, 0x8a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xe420, 0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x75b5,
-  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xb6bd, 0xbdff, 0xbdff, 0xbdff, 0x0421,
-  0x0000, 0x0000, 0x0000, 0x6208, 0xbdff, 0x294a, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xae7b, 0xbdff, 0xbdff, 0xb6bd,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8631,
-  0xbdff, 0xbdff, 0xbdff, 0xbdff, 0x4529, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb9de, 0xbdff, 0xbdff, 0x108c, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x95bd, 0x2842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2108, 0x34ad, 0xbdff, 0xbdff, 0x6529, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xe841, 0xbdff, 0xbdff, 0xbdff,
-  0xcf7b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0xbdff, 0xbdff, 0xbdff,
-  0x0421, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6d73, 0x2842,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa210,
-  0x79d6, 0xbdff, 0xcf83, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xaa5a, 0xbdff, 0xbdff, 0x1be7, 0x8210, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xc318, 0xbdff, 0xbdff, 0x929c, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xe841, 0xe739, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4529, 0x5cf7, 0x3cef,
-  0x6208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c6b, 0xbdff,
-  0xbdff, 0x6a52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6529, 0xbdff,
-  0xbdff, 0x8631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xa310, 0xc739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x284a, 0xbdff, 0x8a52, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xcf83, 0xbdff, 0x95bd, 0x2108, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xe841, 0xbdff, 0xb6bd, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0421, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xcf7b, 0xf7c5, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x929c, 0xbdff, 0x4529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x8a52, 0xbdff, 0x294a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4108, 0x96bd,
-  0xa631, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75b5, 0xef83, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8e73, 0xdae6, 0x4108,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xe418, 0x108c, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xd6c5, 0xa310, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xd29c, 0x4d6b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xe741, 0xe418, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6952,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x17ce,
-  0xe418, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xc318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2108, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2108, 0xb29c, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe418, 0xe739, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2521, 0x2108, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000,
+  0x0201, 0x004d, 0x0048, 0x0000, 0x0000, 0x0002, 0x0000, 0x000f,
+  0x0000, 0x001c, 0x0000, 0x0028, 0x0000, 0x0035, 0x0000, 0x0049,
+  0x0000, 0x005e, 0x0000, 0x0072, 0x0000, 0x0085, 0x0000, 0x009e,
+  0x0000, 0x00b0, 0x0000, 0x00c3, 0x0000, 0x00d8, 0x0000, 0x00eb,
+  0x0000, 0x00f7, 0x0000, 0x0103, 0x0000, 0x010f, 0x0000, 0x011b,
+  0x0000, 0x0127, 0x0000, 0x0133, 0x0000, 0x013f, 0x0000, 0x014b,
+  0x0000, 0x0157, 0x0000, 0x0163, 0x0000, 0x0184, 0x0000, 0x019c,
+  0x0000, 0x01a6, 0x0000, 0x01c9, 0x0000, 0x01e3, 0x0000, 0x01fe,
+  0x0000, 0x0219, 0x0000, 0x0233, 0x0000, 0x024e, 0x0000, 0x026c,
+  0x0000, 0x0293, 0x0000, 0x02b6, 0x0000, 0x02d7, 0x0000, 0x02fa,
+  0x0000, 0x0319, 0x0000, 0x0337, 0x0000, 0x0351, 0x0000, 0x036c,
+  0x0000, 0x038c, 0x0000, 0x03b0, 0x0000, 0x03e1, 0x0000, 0x040d,
+  0x0000, 0x042d, 0x0000, 0x044a, 0x0000, 0x0467, 0x0000, 0x0484,
+  0x0000, 0x04a7, 0x0000, 0x04cc, 0x0000, 0x04f8, 0x0000, 0x0521,
+  0x0000, 0x0547, 0x0000, 0x056d, 0x0000, 0x0591, 0x0000, 0x05b5,
+  0x0000, 0x05d3, 0x0000, 0x05f1, 0x0000, 0x060e, 0x0000, 0x0629,
+  0x0000, 0x0643, 0x0000, 0x0657, 0x0000, 0x0669, 0x0000, 0x067a,
+  0x0000, 0x0689, 0x0000, 0x0694, 0x0000, 0x069b, 0x0000, 0x06a2,
+  0x0000, 0x06a4, 0x0000, 0x804d, 0x0000, 0x800d, 0x0000, 0x0008,
+  0x0421, 0xcf83, 0x99de, 0xbdff, 0x1be7, 0xf3a4, 0x8a52, 0xe418,
+  0x8038, 0x0000, 0x800c, 0x0000, 0x0002, 0x8a52, 0x9df7, 0x8007,
+  0xbdff, 0x0003, 0xb6bd, 0x0c63, 0x2421, 0x8035, 0x0000, 0x800b,
+  0x0000, 0x0001, 0x294a, 0x800c, 0xbdff, 0x0003, 0xd6c5, 0xec62,
+  0x0421, 0x8032, 0x0000, 0x800a, 0x0000, 0x0002, 0x6208, 0x1be7,
+  0x800f, 0xbdff, 0x0003, 0xb6bd, 0xaa5a, 0xa310, 0x802f, 0x0000,
+  0x800a, 0x0000, 0x0001, 0x294a, 0x8008, 0xbdff, 0x0004, 0x7cf7,
+  0xe841, 0x0421, 0xcf83, 0x8006, 0xbdff, 0x0004, 0x9dff, 0xb29c,
+  0xe841, 0x4108, 0x802c, 0x0000, 0x800a, 0x0000, 0x0001, 0x1084,
+  0x8008, 0xbdff, 0x0005, 0xd29c, 0x0000, 0x0000, 0x2000, 0xd29c,
+  0x8008, 0xbdff, 0x0004, 0x1be7, 0xae7b, 0x6629, 0x2000, 0x8029,
+  0x0000, 0x800a, 0x0000, 0x0001, 0x58ce, 0x8008, 0xbdff, 0x0001,
+  0xf3a4, 0x8003, 0x0000, 0x0001, 0x0842, 0x800b, 0xbdff, 0x0003,
+  0x37ce, 0xec62, 0xc318, 0x8027, 0x0000, 0x8009, 0x0000, 0x0001,
+  0xa310, 0x800a, 0xbdff, 0x0004, 0x0421, 0x0000, 0x0000, 0xe841,
+  0x800e, 0xbdff, 0x0003, 0xb29c, 0xc739, 0x2108, 0x8024, 0x0000,
+  0x8009, 0x0000, 0x0007, 0xe741, 0xbdff, 0xbdff, 0x99de, 0x8a52,
+  0x6d73, 0x7df7, 0x8004, 0xbdff, 0x0004, 0x99de, 0x694a, 0xc739,
+  0xf7c5, 0x8010, 0xbdff, 0x0003, 0x99de, 0x0c63, 0xc318, 0x8022,
+  0x0000, 0x8009, 0x0000, 0x0007, 0x4d6b, 0xbdff, 0xbdff, 0x0842,
+  0x0000, 0x0000, 0xa739, 0x801b, 0xbdff, 0x0003, 0xb29c, 0xc739,
+  0x2108, 0x801f, 0x0000, 0x8009, 0x0000, 0x0004, 0xf3a4, 0xbdff,
+  0xbdff, 0x8631, 0x8003, 0x0000, 0x0001, 0x95bd, 0x801c, 0xbdff,
+  0x0003, 0x99de, 0x0c63, 0xc318, 0x801d, 0x0000, 0x8008, 0x0000,
+  0x0005, 0x2000, 0x1be7, 0xbdff, 0xbdff, 0xae7b, 0x8003, 0x0000,
+  0x0001, 0x7194, 0x801e, 0xbdff, 0x0004, 0x9df7, 0x518c, 0x6631,
+  0x2000, 0x801a, 0x0000, 0x8008, 0x0000, 0x0001, 0xe420, 0x8004,
+  0xbdff, 0x0004, 0x8a52, 0x4108, 0x4529, 0x3bef, 0x8021, 0xbdff,
+  0x0003, 0xb6bd, 0x494a, 0x6108, 0x8018, 0x0000, 0x8008, 0x0000,
+  0x0001, 0x0842, 0x802b, 0xbdff, 0x0003, 0x1be7, 0x4d6b, 0xe418,
+  0x8016, 0x0000, 0x8008, 0x0000, 0x0001, 0x2c6b, 0x802e, 0xbdff,
+  0x0003, 0xb29c, 0xa631, 0x2000, 0x8013, 0x0000, 0x8008, 0x0000,
+  0x0001, 0x929c, 0x8030, 0xbdff, 0x0003, 0xd6c5, 0x494a, 0x4108,
+  0x8011, 0x0000, 0x8008, 0x0000, 0x0001, 0x58ce, 0x8032, 0xbdff,
+  0x0003, 0xdae6, 0x0c6b, 0xa318, 0x800f, 0x0000, 0x8007, 0x0000,
+  0x0001, 0x6208, 0x8035, 0xbdff, 0x0003, 0x7df7, 0x1084, 0x4529,
+  0x800d, 0x0000, 0x8007, 0x0000, 0x0001, 0x4529, 0x8038, 0xbdff,
+  0x0003, 0x13a5, 0xc739, 0x2000, 0x800a, 0x0000, 0x8007, 0x0000,
+  0x0001, 0x494a, 0x803a, 0xbdff, 0x0003, 0xf7c5, 0x494a, 0x4108,
+  0x8008, 0x0000, 0x8007, 0x0000, 0x0001, 0x6d73, 0x803c, 0xbdff,
+  0x0003, 0xbade, 0xeb62, 0x8210, 0x8006, 0x0000, 0x8007, 0x0000,
+  0x0001, 0xd3a4, 0x803e, 0xbdff, 0x0003, 0x5cef, 0x6d73, 0xc318,
+  0x8004, 0x0000, 0x8007, 0x0000, 0x0001, 0xb9de, 0x8040, 0xbdff,
+  0x0005, 0x9df7, 0x1084, 0x0421, 0x0000, 0x0000, 0x8006, 0x0000,
+  0x0001, 0x8210, 0x8029, 0xbdff, 0x0001, 0x9dff, 0x8004, 0xfbe6,
+  0x0001, 0x79d6, 0x8003, 0x38ce, 0x0001, 0x17c6, 0x8004, 0x95b5,
+  0x0001, 0x13a5, 0x8003, 0xf3a4, 0x0001, 0xd29c, 0x8004, 0x5194,
+  0x0001, 0xef83, 0x8003, 0xcf7b, 0x0002, 0xc739, 0x0000, 0x8006,
+  0x0000, 0x0001, 0x6629, 0x8013, 0xbdff, 0x0005, 0x79d6, 0x6631,
+  0x6629, 0x6629, 0x6529, 0x8004, 0x0421, 0x0001, 0xe418, 0x8004,
+  0xc318, 0x8004, 0x6208, 0x0001, 0x2108, 0x8020, 0x0000, 0x8006,
+  0x0000, 0x0001, 0x294a, 0x8013, 0xbdff, 0x0001, 0xe841, 0x8032,
+  0x0000, 0x8006, 0x0000, 0x0001, 0x0c6b, 0x8012, 0xbdff, 0x0004,
+  0xd3a4, 0x0000, 0x0000, 0xa318, 0x8004, 0x0421, 0x0003, 0x2529,
+  0x6629, 0x4108, 0x8004, 0x0000, 0x0001, 0xa739, 0x8003, 0x2842,
+  0x0001, 0x294a, 0x8004, 0x8a52, 0x0005, 0xaa5a, 0xeb62, 0xeb62,
+  0xcb5a, 0x4108, 0x8017, 0x0000, 0x8006, 0x0000, 0x0001, 0x308c,
+  0x8011, 0xbdff, 0x0005, 0x9df7, 0x0421, 0x0000, 0x6208, 0x99de,
+  0x8006, 0xbdff, 0x0001, 0x2529, 0x8004, 0x0000, 0x0001, 0x6952,
+  0x800b, 0xbdff, 0x0001, 0x8a52, 0x8018, 0x0000, 0x8006, 0x0000,
+  0x0001, 0x95bd, 0x8011, 0xbdff, 0x0004, 0x4d6b, 0x0000, 0x0000,
+  0x6d73, 0x8007, 0xbdff, 0x0001, 0x6629, 0x8004, 0x0000, 0x0002,
+  0x4108, 0xbade, 0x8009, 0xbdff, 0x0002, 0x308c, 0x2000, 0x8018,
+  0x0000, 0x8006, 0x0000, 0x0001, 0x3bef, 0x8010, 0xbdff, 0x0005,
+  0x99d6, 0x6108, 0x0000, 0x0421, 0x9df7, 0x8007, 0xbdff, 0x0001,
+  0x6629, 0x8005, 0x0000, 0x0001, 0x6d73, 0x8008, 0xbdff, 0x0002,
+  0xb6bd, 0x6108, 0x8019, 0x0000, 0x8005, 0x0000, 0x0001, 0xa310,
+  0x8011, 0xbdff, 0x0004, 0x0842, 0x0000, 0x2000, 0x13a5, 0x8008,
+  0xbdff, 0x0001, 0x6629, 0x8005, 0x0000, 0x0001, 0x0842, 0x8007,
+  0xbdff, 0x0002, 0x1be7, 0xe418, 0x801a, 0x0000, 0x8005, 0x0000,
+  0x0001, 0x6629, 0x8010, 0xbdff, 0x0004, 0xf3a4, 0x2000, 0x0000,
+  0x0842, 0x8007, 0xbdff, 0x0003, 0x5194, 0xbdff, 0xc739, 0x8005,
+  0x0000, 0x0001, 0x4529, 0x8007, 0xbdff, 0x0001, 0xa739, 0x801b,
+  0x0000, 0x8005, 0x0000, 0x0001, 0x294a, 0x800f, 0xbdff, 0x0006,
+  0x9df7, 0x0421, 0x0000, 0x0000, 0x6629, 0x7cf7, 0x8006, 0xbdff,
+  0x0003, 0x0421, 0xf7c5, 0xab5a, 0x8005, 0x0000, 0x0001, 0xe418,
+  0x8006, 0xbdff, 0x0002, 0xae7b, 0x6108, 0x801b, 0x0000, 0x8005,
+  0x0000, 0x0001, 0x0c6b, 0x800f, 0xbdff, 0x0001, 0x6d73, 0x8004,
+  0x0000, 0x0002, 0x0842, 0x9dff, 0x8005, 0xbdff, 0x0003, 0x2521,
+  0xa310, 0xaa5a, 0x8005, 0x0000, 0x0001, 0x6210, 0x8008, 0xbdff,
+  0x000b, 0x9dff, 0xbade, 0xf7c5, 0x95b5, 0xf3a4, 0x7194, 0x308c,
+  0xcf7b, 0x2c6b, 0x8631, 0x4108, 0x8010, 0x0000, 0x8005, 0x0000,
+  0x0001, 0x308c, 0x800e, 0xbdff, 0x0002, 0x99de, 0x6208, 0x8005,
+  0x0000, 0x0002, 0xe841, 0x7cf7, 0x8004, 0xbdff, 0x0001, 0x294a,
+  0x8005, 0x0000, 0x0004, 0x8210, 0xa739, 0x0000, 0x1be7, 0x800b,
+  0xbdff, 0x0005, 0x38ce, 0xef83, 0x494a, 0xe420, 0x2000, 0x8012,
+  0x0000, 0x8005, 0x0000, 0x0001, 0x55b5, 0x800e, 0xbdff, 0x0001,
+  0x0842, 0x8007, 0x0000, 0x0002, 0x4529, 0x79d6, 0x8003, 0xbdff,
+  0x0001, 0x508c, 0x8005, 0x0000, 0x0004, 0x0421, 0xdae6, 0xe418,
+  0x54ad, 0x8007, 0xbdff, 0x0004, 0x3bef, 0x518c, 0x494a, 0xc318,
+  0x8017, 0x0000, 0x8005, 0x0000, 0x0001, 0xbade, 0x800d, 0xbdff,
+  0x0005, 0x13a5, 0x2000, 0x0000, 0x6629, 0x2000, 0x8005, 0x0000,
+  0x0006, 0x8210, 0xcf83, 0xbdff, 0xbdff, 0x7cf7, 0xa310, 0x8004,
+  0x0000, 0x0004, 0xa631, 0xbdff, 0x79d6, 0x9194, 0x8006, 0xbdff,
+  0x0002, 0xf3a4, 0x6108, 0x801a, 0x0000, 0x8004, 0x0000, 0x0001,
+  0x4108, 0x800d, 0xbdff, 0x0006, 0x9df7, 0x0421, 0x0000, 0x4108,
+  0xf7c5, 0x2521, 0x8007, 0x0000, 0x0004, 0x2421, 0xef83, 0x1bef,
+  0x8e7b, 0x8004, 0x0000, 0x0001, 0x2842, 0x800a, 0xbdff, 0x0002,
+  0x95bd, 0x6529, 0x8019, 0x0000, 0x8004, 0x0000, 0x0001, 0x0421,
+  0x800d, 0xbdff, 0x0006, 0x6d73, 0x0000, 0x0000, 0xab5a, 0xbdff,
+  0x6e73, 0x8009, 0x0000, 0x0003, 0x4108, 0x2529, 0x2108, 0x8003,
+  0x0000, 0x0001, 0x494a, 0x800c, 0xbdff, 0x0002, 0x308c, 0x0421,
+  0x8017, 0x0000, 0x8004, 0x0000, 0x0001, 0xa631, 0x800c, 0xbdff,
+  0x0008, 0xb9de, 0x6210, 0x0000, 0xa318, 0x3bef, 0xbdff, 0x7cf7,
+  0xe420, 0x800e, 0x0000, 0x0001, 0x2842, 0x800e, 0xbdff, 0x0002,
+  0x108c, 0x0421, 0x8015, 0x0000, 0x8004, 0x0000, 0x0001, 0x494a,
+  0x800c, 0xbdff, 0x0004, 0x294a, 0x0000, 0x0000, 0x108c, 0x8003,
+  0xbdff, 0x0002, 0x95b5, 0x6108, 0x800d, 0x0000, 0x0001, 0xc739,
+  0x8010, 0xbdff, 0x0002, 0x108c, 0x2521, 0x8013, 0x0000, 0x8004,
+  0x0000, 0x0001, 0x2c6b, 0x800b, 0xbdff, 0x0004, 0x34ad, 0x2000,
+  0x0000, 0x6631, 0x8005, 0xbdff, 0x0002, 0xd3a4, 0x6108, 0x8004,
+  0x0000, 0x0001, 0x0421, 0x8007, 0x0000, 0x0001, 0x2521, 0x8012,
+  0xbdff, 0x0003, 0x13a5, 0xc739, 0x2108, 0x8010, 0x0000, 0x8004,
+  0x0000, 0x0001, 0x108c, 0x800a, 0xbdff, 0x0005, 0x9dff, 0x2421,
+  0x0000, 0x2108, 0xb6bd, 0x8006, 0xbdff, 0x0002, 0x96bd, 0xe420,
+  0x8003, 0x0000, 0x0003, 0x8e73, 0xae7b, 0x2108, 0x8005, 0x0000,
+  0x0002, 0x2108, 0x3cef, 0x8013, 0xbdff, 0x0003, 0x38ce, 0xaa5a,
+  0x8210, 0x800e, 0x0000, 0x8004, 0x0000, 0x0001, 0x34ad, 0x800a,
+  0xbdff, 0x0004, 0x8e73, 0x0000, 0x0000, 0x8a52, 0x8008, 0xbdff,
+  0x0008, 0x5cef, 0xec62, 0x4108, 0x0000, 0xe739, 0xbdff, 0x13ad,
+  0xc318, 0x8005, 0x0000, 0x0001, 0x7194, 0x8005, 0xbdff, 0x0003,
+  0x58d6, 0xaa5a, 0x2842, 0x8004, 0xc739, 0x000c, 0x294a, 0x8a52,
+  0x0c63, 0xcf83, 0xb29c, 0xd6c5, 0x1bef, 0xbdff, 0xbdff, 0x5cf7,
+  0xef83, 0x6529, 0x800c, 0x0000, 0x8004, 0x0000, 0x0001, 0x99d6,
+  0x8009, 0xbdff, 0x0005, 0xbade, 0x8210, 0x0000, 0x8210, 0x1be7,
+  0x800a, 0xbdff, 0x0008, 0x99de, 0xab5a, 0xa210, 0xd29c, 0xbdff,
+  0x5cef, 0x0c6b, 0xa310, 0x8003, 0x0000, 0x0001, 0x8631, 0x8006,
+  0xbdff, 0x0001, 0x0842, 0x800c, 0x0000, 0x0008, 0x6208, 0x0421,
+  0xc739, 0xab5a, 0xae7b, 0x6d73, 0xc739, 0x6208, 0x8009, 0x0000,
+  0x8003, 0x0000, 0x0001, 0x2108, 0x800a, 0xbdff, 0x0004, 0x294a,
+  0x0000, 0x0000, 0xcf83, 0x800d, 0xbdff, 0x0002, 0x9dff, 0x95bd,
+  0x8003, 0xbdff, 0x0006, 0x7cf7, 0x7194, 0x8a52, 0x8631, 0x4529,
+  0x95bd, 0x8005, 0xbdff, 0x0002, 0x7cf7, 0x4529, 0x801c, 0x0000,
+  0x8003, 0x0000, 0x0001, 0xc318, 0x8009, 0xbdff, 0x000b, 0x54ad,
+  0x2000, 0x0000, 0x4529, 0xbdff, 0x9df7, 0x99d6, 0x55b5, 0x9194,
+  0x8e7b, 0x8e73, 0x8014, 0xbdff, 0x0006, 0x7cf7, 0x5cef, 0xbdff,
+  0xbdff, 0xfae6, 0x0421, 0x801b, 0x0000, 0x8003, 0x0000, 0x0001,
+  0x4529, 0x8009, 0xbdff, 0x0006, 0x2521, 0x0000, 0x0000, 0xa310,
+  0xa210, 0x2000, 0x8004, 0x0000, 0x0001, 0x6d73, 0x8014, 0xbdff,
+  0x0007, 0x7cf7, 0xc318, 0x8e73, 0x9df7, 0xbdff, 0x58d6, 0xa318,
+  0x801a, 0x0000, 0x8003, 0x0000, 0x0001, 0xe841, 0x8008, 0xbdff,
+  0x0001, 0x8e7b, 0x8009, 0x0000, 0x0006, 0xe420, 0x9df7, 0xbdff,
+  0xbdff, 0xf3a4, 0xd6c5, 0x8011, 0xbdff, 0x0007, 0x2529, 0x0000,
+  0xe420, 0x929c, 0xbdff, 0xf7c5, 0xa318, 0x8019, 0x0000, 0x8003,
+  0x0000, 0x0001, 0x8a52, 0x8007, 0xbdff, 0x0002, 0xdae6, 0x8210,
+  0x8009, 0x0000, 0x0006, 0x929c, 0xbdff, 0xbdff, 0xae7b, 0x2108,
+  0x9194, 0x8009, 0xbdff, 0x0001, 0x9dff, 0x8007, 0xbdff, 0x0001,
+  0xaa5a, 0x8003, 0x0000, 0x0004, 0xa631, 0x37ce, 0xd6c5, 0x8210,
+  0x8018, 0x0000, 0x8003, 0x0000, 0x0001, 0x2d6b, 0x8007, 0xbdff,
+  0x0001, 0x494a, 0x8009, 0x0000, 0x0007, 0xa631, 0xbdff, 0xbdff,
+  0xcb62, 0x0000, 0x0000, 0xef83, 0x8009, 0xbdff, 0x0003, 0x54ad,
+  0x494a, 0x7df7, 0x8005, 0xbdff, 0x0001, 0xd3a4, 0x8004, 0x0000,
+  0x0004, 0x4108, 0x0c63, 0x75b5, 0x8210, 0x8017, 0x0000, 0x8003,
+  0x0000, 0x0001, 0x108c, 0x8006, 0xbdff, 0x0002, 0x55b5, 0x2000,
+  0x8008, 0x0000, 0x0004, 0x2108, 0xf7c5, 0x9dff, 0x294a, 0x8003,
+  0x0000, 0x0001, 0xcf7b, 0x8005, 0xbdff, 0x0008, 0x58ce, 0x0c63,
+  0xbdff, 0xbdff, 0x5194, 0x0000, 0xa631, 0x3cef, 0x8004, 0xbdff,
+  0x0002, 0x9dff, 0x8210, 0x8005, 0x0000, 0x0003, 0xe420, 0x2c6b,
+  0x6208, 0x8016, 0x0000, 0x8003, 0x0000, 0x0001, 0x34ad, 0x8006,
+  0xbdff, 0x0001, 0x4529, 0x8009, 0x0000, 0x0003, 0xaa5a, 0x7cf7,
+  0xe841, 0x8004, 0x0000, 0x0001, 0xcf83, 0x8005, 0xbdff, 0x0009,
+  0xa739, 0xe418, 0xbdff, 0xbdff, 0x8e73, 0x0000, 0x0000, 0x6631,
+  0x3cef, 0x8004, 0xbdff, 0x0001, 0x494a, 0x8006, 0x0000, 0x0002,
+  0x2000, 0xc318, 0x8016, 0x0000, 0x8003, 0x0000, 0x0001, 0x17ce,
+  0x8005, 0xbdff, 0x0001, 0xae7b, 0x8009, 0x0000, 0x0003, 0xa318,
+  0xbade, 0xa739, 0x8005, 0x0000, 0x0001, 0x5194, 0x8004, 0xbdff,
+  0x0006, 0x929c, 0x0000, 0x0000, 0xd6c5, 0xbdff, 0x0c6b, 0x8003,
+  0x0000, 0x0002, 0x8631, 0x7cf7, 0x8003, 0xbdff, 0x0001, 0xd29c,
+  0x801e, 0x0000, 0x8003, 0x0000, 0x0001, 0x5cf7, 0x8004, 0xbdff,
+  0x0002, 0xfae6, 0x8210, 0x8009, 0x0000, 0x0002, 0xcf83, 0x6631,
+  0x8006, 0x0000, 0x0001, 0xd3a4, 0x8004, 0xbdff, 0x0006, 0x0421,
+  0x0000, 0x0000, 0x6d73, 0xbdff, 0xab5a, 0x8004, 0x0000, 0x0001,
+  0xe739, 0x8003, 0xbdff, 0x0002, 0x9dff, 0x8210, 0x801d, 0x0000,
+  0x8002, 0x0000, 0x0001, 0x6210, 0x8005, 0xbdff, 0x0001, 0x694a,
+  0x8009, 0x0000, 0x8002, 0x4529, 0x8007, 0x0000, 0x0001, 0x54ad,
+  0x8003, 0xbdff, 0x0001, 0x108c, 0x8003, 0x0000, 0x0003, 0xa739,
+  0xbdff, 0x8a52, 0x8005, 0x0000, 0x0001, 0x8a52, 0x8003, 0xbdff,
+  0x0001, 0x8a52, 0x801d, 0x0000, 0x8002, 0x0000, 0x0001, 0xe420,
+  0x8004, 0xbdff, 0x0002, 0x75b5, 0x2000, 0x8009, 0x0000, 0x0001,
+  0x6208, 0x8008, 0x0000, 0x0001, 0xb6bd, 0x8003, 0xbdff, 0x0001,
+  0x0421, 0x8003, 0x0000, 0x0003, 0x6208, 0xbdff, 0x294a, 0x8006,
+  0x0000, 0x0004, 0xae7b, 0xbdff, 0xbdff, 0xb6bd, 0x801d, 0x0000,
+  0x8002, 0x0000, 0x0001, 0x8631, 0x8004, 0xbdff, 0x0001, 0x4529,
+  0x8013, 0x0000, 0x0004, 0xb9de, 0xbdff, 0xbdff, 0x108c, 0x8005,
+  0x0000, 0x0002, 0x95bd, 0x2842, 0x8006, 0x0000, 0x0005, 0x2108,
+  0x34ad, 0xbdff, 0xbdff, 0x6529, 0x801c, 0x0000, 0x8002, 0x0000,
+  0x0001, 0xe841, 0x8003, 0xbdff, 0x0001, 0xcf7b, 0x8013, 0x0000,
+  0x0001, 0x4108, 0x8003, 0xbdff, 0x0001, 0x0421, 0x8005, 0x0000,
+  0x0002, 0x6d73, 0x2842, 0x8007, 0x0000, 0x0004, 0xa210, 0x79d6,
+  0xbdff, 0xcf83, 0x801c, 0x0000, 0x8002, 0x0000, 0x0005, 0xaa5a,
+  0xbdff, 0xbdff, 0x1be7, 0x8210, 0x8013, 0x0000, 0x0004, 0xc318,
+  0xbdff, 0xbdff, 0x929c, 0x8006, 0x0000, 0x0002, 0xe841, 0xe739,
+  0x8008, 0x0000, 0x0004, 0x4529, 0x5cf7, 0x3cef, 0x6208, 0x801b,
+  0x0000, 0x8002, 0x0000, 0x0004, 0x2c6b, 0xbdff, 0xbdff, 0x6a52,
+  0x8014, 0x0000, 0x0004, 0x6529, 0xbdff, 0xbdff, 0x8631, 0x8006,
+  0x0000, 0x0002, 0xa310, 0xc739, 0x8009, 0x0000, 0x0003, 0x284a,
+  0xbdff, 0x8a52, 0x801b, 0x0000, 0x8002, 0x0000, 0x0004, 0xcf83,
+  0xbdff, 0x95bd, 0x2108, 0x8014, 0x0000, 0x0004, 0xe841, 0xbdff,
+  0xb6bd, 0x2000, 0x8007, 0x0000, 0x0001, 0x0421, 0x800a, 0x0000,
+  0x0003, 0xcf7b, 0xf7c5, 0x2000, 0x801a, 0x0000, 0x8002, 0x0000,
+  0x0003, 0x929c, 0xbdff, 0x4529, 0x8015, 0x0000, 0x0003, 0x8a52,
+  0xbdff, 0x294a, 0x8013, 0x0000, 0x0003, 0x4108, 0x96bd, 0xa631,
+  0x801a, 0x0000, 0x8002, 0x0000, 0x0002, 0x75b5, 0xef83, 0x8016,
+  0x0000, 0x0003, 0x8e73, 0xdae6, 0x4108, 0x8014, 0x0000, 0x0002,
+  0xe418, 0x108c, 0x801a, 0x0000, 0x8002, 0x0000, 0x0002, 0xd6c5,
+  0xa310, 0x8016, 0x0000, 0x0002, 0xd29c, 0x4d6b, 0x8016, 0x0000,
+  0x0002, 0xe741, 0xe418, 0x8019, 0x0000, 0x8002, 0x0000, 0x0001,
+  0x6952, 0x8017, 0x0000, 0x0002, 0x17ce, 0xe418, 0x8017, 0x0000,
+  0x0001, 0xc318, 0x8019, 0x0000, 0x8002, 0x0000, 0x0001, 0x2108,
+  0x8016, 0x0000, 0x0002, 0x2108, 0xb29c, 0x8032, 0x0000, 0x8019,
+  0x0000, 0x0002, 0xe418, 0xe739, 0x8032, 0x0000, 0x8019, 0x0000,
+  0x0002, 0x2521, 0x2108, 0x8032, 0x0000, 0x804d, 0x0000, 0x804d,
+  0x0000,
 };
 
 #ifdef __cplusplus
 }
 #endif  /* __cplusplus */
 
-#endif  /* __IMAGE_logo_H__ */
+#endif  /* __IMAGE_LOGO_H__ */
@@ -0,0 +1,82 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "image.h"
+
+
+int image_getSize(const uint16_t *image, uint32_t *width, uint32_t *height) {
+    if (image[0] != IMAGE_FORMAT_RLE) { return -1; }
+    *width = image[1];
+    *height = image[2];
+    return 0;
+}
+
+const uint16_t* image_decodeTokens(const uint16_t *tokens, uint32_t width,
+  uint16_t *output) {
+
+    for (uint32_t x = 0; x < width;) {
+        uint16_t token = *tokens++;
+
+        uint32_t count = token & 0x7fff;
+        if (count == 0 || count > width - x) { return NULL; }
+
+        if (token & 0x8000) {
+            uint16_t color = *tokens++;
+            for (uint32_t i = 0; i < count; i++) { output[x + i] = color; }
+        } else {
+            memcpy(&output[x], tokens, count * sizeof(uint16_t));
+            tokens += count;
+        }
+
+        x += count;
+    }
+
+    return tokens;
+}
+
+int image_decodeRow(const uint16_t *image, uint32_t y, uint16_t *output) {
+    uint32_t width, height;
+    if (image_getSize(image, &width, &height)) { return -1; }
+    if (y >= height) { return -1; }
+
+    const uint16_t *index = &image[IMAGE_HEADER_LENGTH + 2 * y];
+    const uint16_t *tokens = &image[IMAGE_HEADER_LENGTH + 2 * height +
+      (index[0] | ((uint32_t)index[1] << 16))];
+
+    if (image_decodeTokens(tokens, width, output) == NULL) { return -2; }
+
+    return 0;
+}
+
+// Same as encodeRow in scripts/image.mjs; a run of 2 is only used if it
+// does not split a literal
+size_t image_encodeTokens(const uint16_t *pixels, uint32_t width, uint16_t *output) {
+    size_t length = 0;
+
+    // The position of the current literal's count, if any
+    size_t literal = 0;
+    bool inLiteral = false;
+
+    for (uint32_t x = 0; x < width;) {
+        uint32_t run = 1;
+        while (x + run < width && run < 0x7fff && pixels[x + run] == pixels[x]) { run++; }
+
+        if (run >= 3 || (run == 2 && !inLiteral)) {
+            inLiteral = false;
+            output[length++] = 0x8000 | run;
+            output[length++] = pixels[x];
+            x += run;
+
+        } else {
+            if (!inLiteral || output[literal] == 0x7fff) {
+                inLiteral = true;
+                literal = length++;
+                output[literal] = 0;
+            }
+            output[literal]++;
+            output[length++] = pixels[x++];
+        }
+    }
+
+    return length;
+}
@@ -0,0 +1,49 @@
+#ifndef __IMAGE_H__
+#define __IMAGE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// A compressed image (see scripts/image.mjs, which generates them), of
+// uint16 words:
+//
+//   format, width, height
+//   row index; height uint32 offsets (low word first) into the data
+//   data; each row is a sequence of tokens, which never cross a row:
+//     - 0x8000 | n, color       a run of n pixels of color
+//     - n, color * n            n literal pixels
+//
+// Pixels are byte-swapped RGB565, as the display expects. The row index
+// allows any row to be decoded directly into a fragment, without ever
+// inflating the whole image.
+
+#define IMAGE_FORMAT_RLE      (0x0201)
+#define IMAGE_HEADER_LENGTH   (3)
+
+
+// Returns 0 if the image is a supported format
+int image_getSize(const uint16_t *image, uint32_t *width, uint32_t *height);
+
+// Decodes row y into output (width pixels)
+int image_decodeRow(const uint16_t *image, uint32_t y, uint16_t *output);
+
+// Decodes one row of tokens (without an image header) into output,
+// returning the tokens following the row, or NULL if they are invalid
+const uint16_t* image_decodeTokens(const uint16_t *tokens, uint32_t width,
+  uint16_t *output);
+
+// Encodes one row of pixels as tokens into output, which must have room
+// for at least (width + 1) words; returns the number of words written
+size_t image_encodeTokens(const uint16_t *pixels, uint32_t width, uint16_t *output);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __IMAGE_H__ */
@@ -1,8 +1,15 @@
+#include <stdbool.h>
 #include <string.h>
 
 #include "keypair.h"
+#include "montgomery.h"
+#include "sha2.h"
 
-#include "esp_efuse.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 
 #include "mbedtls/platform.h"
 #include "mbedtls/entropy.h"
@@ -10,68 +17,6 @@
 #include "mbedtls/rsa.h"
 
 
-static void copy_value(uint8_t *dst, uint8_t *src, size_t length) {
-    for (int i = 0; i < length; i++) { dst[i] = src[i]; }
-
-    for (int i = 0; i < length / 2; i++) {
-        uint8_t tmp = dst[i];
-        dst[i] = dst[length - 1 - i];
-        dst[length - 1 - i] = tmp;
-    }
-}
-
-static int copy_mpi(uint32_t keySize, mbedtls_mpi* value, uint32_t *dst) {
-    uint8_t tmp[keySize / 8];
-    int ret = mbedtls_mpi_write_binary(value, tmp, keySize / 8);
-    if (ret) { return ret; }
-    copy_value((uint8_t*)dst, tmp, keySize / 8);
-    return ret;
-}
-
-//https://github.com/espressif/esp_secure_cert_mgr/issues/8
-static int compute_rinv_mprime(uint32_t keySize, mbedtls_mpi* N, mbedtls_mpi* rinv, uint32_t* mprime) {
-    // python equivalent code:
-    //
-    //    key_size = private_key.key_size # in bits
-    //
-    //    # calculate rinv == Rb
-    //    rr = 1 << (key_size * 2)
-    //    rinv = rr % pub_numbers.n # RSA r inverse operand
-    //
-    //    # calculate MPrime
-    //    a = rsa._modinv(M, 1 << 32)
-    //    mprime = (a * -1) & 0xFFFFFFFF # RSA M prime operand
-
-    // rr = 1 << (key_size * 2) # in bits
-    mbedtls_mpi rr;
-    mbedtls_mpi_init(&rr);
-    mbedtls_mpi_lset(&rr, 1);
-//    mbedtls_mpi_shift_l(&rr, sizeof(pd_4096_bit_t) * 8 * 2);
-    mbedtls_mpi_shift_l(&rr, keySize * 2); // RicMoo!
-
-    // rinv = rr % rsa.N
-    mbedtls_mpi_mod_mpi(rinv, &rr, N);
-
-    // ls32 = 1 << 32
-    mbedtls_mpi ls32;
-    mbedtls_mpi_init(&ls32);
-    mbedtls_mpi_lset(&ls32, 1);
-    mbedtls_mpi_shift_l(&ls32, 32);
-
-    // a = rsa._modinv(N, 1 << 32)
-    mbedtls_mpi a;
-    mbedtls_mpi_init(&a);
-    mbedtls_mpi_inv_mod(&a, N, &ls32);
-
-    // a32 = a
-    uint32_t a32 = 0;
-    mbedtls_mpi_write_binary_le(&a, (uint8_t*) &a32, sizeof(uint32_t));
-
-    // mprime
-    *mprime = ((int32_t) a32 * -1) & 0xFFFFFFFF;
-
-    return 0;
-}
 /*
 int getKeyBlock(int slot) {
     switch(slot) {
@@ -115,77 +60,563 @@ void keypair_dumpMpi(char *header, mbedtls_mpi* value) {
 }
 
 int keypair_getParams(KeyPair *keypair, esp_ds_p_data_t *params) {
-    int ret = 0;
+    uint32_t keySize = keypair->key_size;
+    if (keySize == 0 || (keySize % 32) || keySize / 8 > sizeof(params->M)) {
+        return -1;
+    }
+    if (mbedtls_mpi_bitlen(&keypair->N) != keySize) { return -1; }
 
-    params->length = (keypair->key_size / 32) - 1;
+    size_t words = keySize / 32;
 
-    ret = copy_mpi(keypair->key_size, &keypair->N, params->M);
+    params->length = words - 1;
+
+    // The DS peripheral uses little-endian words
+    int ret = mbedtls_mpi_write_binary_le(&keypair->N, (uint8_t*)params->M, keySize / 8);
     if (ret) { return ret; }
     //dumpBuffer("<PARAMS-M=", (uint8_t*)params->M, sizeof(params->M));
 
-    ret = copy_mpi(keypair->key_size, &keypair->D, params->Y);
+    ret = mbedtls_mpi_write_binary_le(&keypair->D, (uint8_t*)params->Y, keySize / 8);
     if (ret) { return ret; }
     //dumpBuffer("!<PARAMS-Y=", (uint8_t*)params->Y, sizeof(params->Y));
 
-    ret = copy_mpi(keypair->key_size, &keypair->Rb, params->Rb);
+    ret = montgomery_computeRb(params->M, params->Rb, words);
+    if (ret) {
+        printf("! failed to compute Rb (code=%d)\n", ret);
+        return ret;
+    }
+
+    ret = montgomery_computeMPrime(params->M[0], &params->M_prime);
+    if (ret) {
+        printf("! failed to compute M_prime (code=%d)\n", ret);
+        return ret;
+    }
+
+    return 0;
+}
+
+int keypair_computeRR(const uint8_t *pubkeyN, uint8_t *rr, size_t length) {
+    if (length == 0 || (length % 4)) { return -1; }
+
+    size_t words = length / 4;
+
+    // Big-endian bytes to (and from) little-endian words
+    uint32_t M[words], Rb[words];
+    for (size_t i = 0; i < words; i++) {
+        const uint8_t *word = &pubkeyN[length - 4 * (i + 1)];
+        M[i] = (word[0] << 24) | (word[1] << 16) | (word[2] << 8) | word[3];
+    }
+
+    int ret = montgomery_computeRb(M, Rb, words);
     if (ret) { return ret; }
 
-    params->M_prime = keypair->m_prime;
+    for (size_t i = 0; i < words; i++) {
+        uint8_t *word = &rr[length - 4 * (i + 1)];
+        word[0] = Rb[i] >> 24;
+        word[1] = Rb[i] >> 16;
+        word[2] = Rb[i] >> 8;
+        word[3] = Rb[i];
+    }
+
+    return 0;
+}
+
+int keypair_verify(const uint8_t *pubkeyN, const uint8_t *rr,
+  const uint8_t *signature, uint8_t *message, size_t length) {
+
+    mbedtls_mpi N, RR, E, S, M;
+    mbedtls_mpi_init(&N);
+    mbedtls_mpi_init(&RR);
+    mbedtls_mpi_init(&E);
+    mbedtls_mpi_init(&S);
+    mbedtls_mpi_init(&M);
+
+    int ret = mbedtls_mpi_read_binary(&N, pubkeyN, length);
+    if (ret == 0) { ret = mbedtls_mpi_read_binary(&RR, rr, length); }
+    if (ret == 0) { ret = mbedtls_mpi_read_binary(&S, signature, length); }
+    if (ret == 0) { ret = mbedtls_mpi_lset(&E, EXPONENT); }
+
+    // A signature which is not reduced is never valid
+    if (ret == 0 && mbedtls_mpi_cmp_mpi(&S, &N) >= 0) { ret = -1; }
+
+    // With RR populated, the (hardware) exponentiation skips computing it
+    if (ret == 0) { ret = mbedtls_mpi_exp_mod(&M, &S, &E, &N, &RR); }
+    if (ret == 0) { ret = mbedtls_mpi_write_binary(&M, message, length); }
+
+    mbedtls_mpi_free(&N);
+    mbedtls_mpi_free(&RR);
+    mbedtls_mpi_free(&E);
+    mbedtls_mpi_free(&S);
+    mbedtls_mpi_free(&M);
 
     return ret;
 }
 
-// https://github.com/Mbed-TLS/mbedtls/blob/development/programs/pkey/rsa_genkey.c
-int keypair_generate(KeyPair *keypair, uint32_t key_size, uint8_t *extraEntropy, size_t extraLength) {
-    keypair->key_size = key_size;
+///////////////////////////////
+// Prime search
+//
+// Rather than paying for a Miller-Rabin test on every odd candidate,
+// candidates are sieved in windows of odd offsets from a random start,
+// using the residues of the start modulo a table of small primes. Only
+// the survivors are tested (using the hardware MPI).
+
+#define SIEVE_PRIMES   (2048)
+
+// Number of odd offsets per window; ~7 primes are expected per window
+// for 1536-bit candidates
+#define SIEVE_WINDOW   (4096)
+
+// The odd primes 3, 5, 7, ..., 17881
+static uint16_t smallPrimes[SIEVE_PRIMES] = { 0 };
+
+static void initSmallPrimes() {
+    if (smallPrimes[SIEVE_PRIMES - 1]) { return; }
+
+    size_t count = 0;
+    for (uint32_t n = 3; count < SIEVE_PRIMES; n += 2) {
+        bool prime = true;
+        for (size_t i = 0; i < count; i++) {
+            uint32_t p = smallPrimes[i];
+            if (p * p > n) { break; }
+            if ((n % p) == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) { smallPrimes[count++] = n; }
+    }
+}
 
-    int ret = 0;
+// Marks each odd offset k within the window for which (X + 2k) is
+// divisible by p, given r = X % p. The inverse of 2 is (p + 1) / 2.
+static void sieveMark(uint8_t *composite, uint32_t p, uint32_t r) {
+    uint32_t k = (((p - r) % p) * ((p + 1) / 2)) % p;
+    for (; k < SIEVE_WINDOW; k += p) { composite[k >> 3] |= (1 << (k & 7)); }
+}
 
-    mbedtls_rsa_context rsa;
+// Returned by generatePrime when cancelled
+#define PRIME_CANCELLED   (-1)
+
+// Reports the search to a KeyPairProgressFunc; primes is the number
+// already found. If cancel is set, the search stops (returning
+// PRIME_CANCELLED) after the current candidate.
+typedef struct PrimeProgress {
+    KeyPairProgressFunc func;
+    void *context;
+    uint32_t primes;
+    const volatile bool *cancel;
+} PrimeProgress;
+
+// Generates a prime suitable for an RSA factor; the prime must be
+// coprime to the exponent, i.e. (X - 1) % E != 0
+static int generatePrime(mbedtls_mpi *X, uint32_t nbits,
+  int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+  const PrimeProgress *progress) {
+
+    if (nbits < 64 || (nbits % 8)) { return MBEDTLS_ERR_MPI_BAD_INPUT_DATA; }
+
+    initSmallPrimes();
+
+    // Rounds for an error probability below 2^-100; matches the
+    // MBEDTLS_MPI_GEN_PRIME_FLAG_LOW_ERR table in mbedtls_mpi_gen_prime
+    int rounds = ((nbits >= 1450) ? 4: (nbits >= 1150) ? 5:
+      (nbits >= 1000) ? 6: (nbits >= 850) ? 7: (nbits >= 750) ? 8:
+      (nbits >= 500) ? 13: (nbits >= 250) ? 28: (nbits >= 150) ? 40: 51);
+
+    uint8_t composite[SIEVE_WINDOW / 8];
+
+    uint32_t candidates = 0;
+
+    while (1) {
+        int ret = mbedtls_mpi_fill_random(X, nbits / 8, f_rng, p_rng);
+        if (ret) { return ret; }
+
+        // Setting the top two bits guarantees X > sqrt(2) * 2^(nbits - 1),
+        // so the product of two such primes has exactly 2 * nbits bits
+        mbedtls_mpi_set_bit(X, nbits - 1, 1);
+        mbedtls_mpi_set_bit(X, nbits - 2, 1);
+        mbedtls_mpi_set_bit(X, 0, 1);
+
+        memset(composite, 0, sizeof(composite));
+
+        mbedtls_mpi_uint r = 0;
+        for (size_t i = 0; i < SIEVE_PRIMES; i++) {
+            ret = mbedtls_mpi_mod_int(&r, X, smallPrimes[i]);
+            if (ret) { return ret; }
+            sieveMark(composite, smallPrimes[i], r);
+        }
+
+        // Remove candidates where (X + 2k) % E == 1
+        ret = mbedtls_mpi_mod_int(&r, X, EXPONENT);
+        if (ret) { return ret; }
+        sieveMark(composite, EXPONENT, (r + EXPONENT - 1) % EXPONENT);
+
+        uint32_t last = 0;
+        for (uint32_t k = 0; k < SIEVE_WINDOW; k++) {
+            if (composite[k >> 3] & (1 << (k & 7))) { continue; }
+
+            // Advance X to the candidate (X + 2k)
+            ret = mbedtls_mpi_add_int(X, X, 2 * (k - last));
+            if (ret) { return ret; }
+            last = k;
+
+            // Overflowed the bit length; start a new window
+            if (mbedtls_mpi_bitlen(X) != nbits) { break; }
+
+            ret = mbedtls_mpi_is_prime_ext(X, rounds, f_rng, p_rng);
+            if (ret == 0) { return 0; }
+            if (ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE) { return ret; }
+
+            candidates++;
+            if (progress && progress->func) {
+                progress->func(progress->primes, candidates, progress->context);
+            }
+
+            if (progress && progress->cancel && *progress->cancel) {
+                return PRIME_CANCELLED;
+            }
+        }
+    }
+}
+
+// Mirrors the |P - Q| check of mbedtls_rsa_gen_key
+static bool checkPrimeDistance(mbedtls_mpi *P, mbedtls_mpi *Q, uint32_t key_size) {
+    mbedtls_mpi H;
+    mbedtls_mpi_init(&H);
+
+    bool ok = false;
+    if (mbedtls_mpi_sub_abs(&H, P, Q) == 0) {
+        ok = (mbedtls_mpi_bitlen(&H) > ((key_size >= 200) ? ((key_size >> 1) - 99): 0));
+    }
+
+    mbedtls_mpi_free(&H);
+
+    return ok;
+}
+
+
+///////////////////////////////
+// Prime pool
+//
+// While the REPL is idle waiting for the host, a low-priority task
+// searches for primes ahead of time, so GEN-KEY can usually skip the
+// prime search entirely. The search is re-seeded with the host entropy
+// on every stir, and any primes found before the stir are discarded.
+//
+// The task only exists until it is no longer useful; keypair_generate
+// stops it before its own search, and BURN stops it (see
+// keypair_poolStop), freeing its stack, DRBG and any pooled primes.
+//
+// Locking: pool.lock only guards the bookkeeping below and is never
+// held during a search. The search itself takes the hardware MPI lock
+// for each operation (e.g. a Miller-Rabin exponentiation), so a higher
+// priority task needing the MPI (such as GEN-KEY or the self-test)
+// waits for at most one operation, with the pool task inheriting its
+// priority meanwhile. GEN-KEY never overlaps a running search, as it
+// stops the task (which exits after its current candidate) first.
+
+#define POOL_SIZE      (2)
+
+typedef struct PrimePool {
+    SemaphoreHandle_t lock;
+    uint32_t key_size;
+
+    // The search task, until stopped; stopping is set to cancel it, and
+    // stopped is given once it has freed its resources
+    TaskHandle_t task;
+    volatile bool stopping;
+    SemaphoreHandle_t stopped;
+
+    // Incremented on each stir; primes from an older generation are stale
+    uint32_t generation;
+
+    uint8_t seed[32];
+    size_t seedLength;
+
+    mbedtls_mpi primes[POOL_SIZE];
+    size_t count;
+} PrimePool;
+
+static PrimePool pool = { 0 };
+
+
+static void poolTask(void *arg) {
     mbedtls_entropy_context entropy;
     mbedtls_ctr_drbg_context ctr_drbg;
 
-    /**
-      Public:
-        N - the RSA modulus
-        E - the public exponent
-      Private:
-        P - the first prime factor of N
-        Q - the second prime factor of N
-        D - the private exponent
-     */
+    mbedtls_entropy_init(&entropy);
     mbedtls_ctr_drbg_init(&ctr_drbg);
-    mbedtls_rsa_init(&rsa);
-    mbedtls_mpi_init(&keypair->N);
-    mbedtls_mpi_init(&keypair->P);
-    mbedtls_mpi_init(&keypair->Q);
-    mbedtls_mpi_init(&keypair->D);
-    mbedtls_mpi_init(&keypair->E);
-    mbedtls_mpi_init(&keypair->Rb);
 
-    uint32_t m_prime = 0;
+    mbedtls_mpi prime;
+    mbedtls_mpi_init(&prime);
+
+    xSemaphoreTake(pool.lock, portMAX_DELAY);
+    uint32_t generation = pool.generation;
+    int ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func,
+      &entropy, pool.seed, pool.seedLength);
+    xSemaphoreGive(pool.lock);
+
+    // Without a DRBG, idle until stopped
+    if (ret) { printf("! prime pool mbedtls_ctr_drbg_seed=%d\n", ret); }
+
+    PrimeProgress progress = { .cancel = &pool.stopping };
+
+    while (!pool.stopping) {
+        if (ret) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        xSemaphoreTake(pool.lock, portMAX_DELAY);
+        if (generation != pool.generation) {
+            generation = pool.generation;
+            mbedtls_ctr_drbg_reseed(&ctr_drbg, pool.seed, pool.seedLength);
+        }
+        bool full = (pool.count == POOL_SIZE);
+        xSemaphoreGive(pool.lock);
+
+        // Woken by a stir (which empties the pool) or keypair_poolStop
+        if (full) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        int err = generatePrime(&prime, pool.key_size / 2,
+          mbedtls_ctr_drbg_random, &ctr_drbg, &progress);
+        if (err) {
+            if (err != PRIME_CANCELLED) { ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)); }
+            continue;
+        }
+
+        xSemaphoreTake(pool.lock, portMAX_DELAY);
+        if (generation == pool.generation && pool.count < POOL_SIZE) {
+            mbedtls_mpi_swap(&pool.primes[pool.count++], &prime);
+        }
+        xSemaphoreGive(pool.lock);
+    }
+
+    mbedtls_mpi_free(&prime);
+    mbedtls_ctr_drbg_free(&ctr_drbg);
+    mbedtls_entropy_free(&entropy);
+
+    xSemaphoreGive(pool.stopped);
+    vTaskDelete(NULL);
+}
+
+int keypair_poolStart(uint32_t key_size, uint8_t *entropy, size_t entropyLength) {
+    if (pool.lock) { return 0; }
+    if (entropyLength > sizeof(pool.seed)) { return -1; }
+
+    pool.lock = xSemaphoreCreateMutex();
+    pool.stopped = xSemaphoreCreateBinary();
+    if (pool.lock == NULL || pool.stopped == NULL) { return -2; }
+
+    initSmallPrimes();
+
+    pool.key_size = key_size;
+    memcpy(pool.seed, entropy, entropyLength);
+    pool.seedLength = entropyLength;
+
+    for (int i = 0; i < POOL_SIZE; i++) { mbedtls_mpi_init(&pool.primes[i]); }
+
+    BaseType_t status = xTaskCreate(poolTask, "prime-pool", 8192, NULL,
+      tskIDLE_PRIORITY, &pool.task);
+    if (status != pdPASS) {
+        pool.task = NULL;
+        return -3;
+    }
+
+    return 0;
+}
+
+// Stops the search task, waiting for it to exit; any pooled primes are
+// kept (see keypair_poolStop)
+static void poolHalt() {
+    if (pool.task == NULL) { return; }
+
+    pool.stopping = true;
+    xTaskNotifyGive(pool.task);
+
+    // The task exits after its current candidate, and runs meanwhile as
+    // the caller is blocked
+    xSemaphoreTake(pool.stopped, portMAX_DELAY);
+    pool.task = NULL;
+}
+
+void keypair_poolStop() {
+    if (pool.lock == NULL) { return; }
+
+    poolHalt();
+
+    xSemaphoreTake(pool.lock, portMAX_DELAY);
+    for (int i = 0; i < POOL_SIZE; i++) {
+        mbedtls_mpi_free(&pool.primes[i]);
+        mbedtls_mpi_init(&pool.primes[i]);
+    }
+    pool.count = 0;
+    xSemaphoreGive(pool.lock);
+}
+
+void keypair_poolStir(uint8_t *entropy, size_t entropyLength) {
+    if (pool.lock == NULL) { return; }
+    if (entropyLength > sizeof(pool.seed)) { return; }
+
+    xSemaphoreTake(pool.lock, portMAX_DELAY);
+
+    memcpy(pool.seed, entropy, entropyLength);
+    pool.seedLength = entropyLength;
+    pool.generation++;
+
+    for (int i = 0; i < POOL_SIZE; i++) {
+        mbedtls_mpi_free(&pool.primes[i]);
+        mbedtls_mpi_init(&pool.primes[i]);
+    }
+    pool.count = 0;
+
+    xSemaphoreGive(pool.lock);
+
+    if (pool.task) { xTaskNotifyGive(pool.task); }
+}
+
+// Moves a pooled prime into X, if one is available that was searched
+// for using the current entropy; returns 0 on success
+static int poolTake(mbedtls_mpi *X, uint32_t key_size, uint8_t *entropy, size_t entropyLength) {
+    if (pool.lock == NULL) { return -1; }
+
+    int ret = -1;
+
+    xSemaphoreTake(pool.lock, portMAX_DELAY);
+
+    if (pool.count && pool.key_size == key_size &&
+      pool.seedLength == entropyLength &&
+      memcmp(pool.seed, entropy, entropyLength) == 0) {
+
+        pool.count--;
+        mbedtls_mpi_swap(X, &pool.primes[pool.count]);
+        mbedtls_mpi_free(&pool.primes[pool.count]);
+        ret = 0;
+    }
+
+    xSemaphoreGive(pool.lock);
+
+    return ret;
+}
+
+
+typedef int (*EntropyFunc)(void *, unsigned char *, size_t);
+
+// https://github.com/Mbed-TLS/mbedtls/blob/development/programs/pkey/rsa_genkey.c
+static int generate(KeyPair *keypair, uint32_t key_size, EntropyFunc f_entropy,
+  void *p_entropy, uint8_t *extraEntropy, size_t extraLength, bool usePool,
+  bool baseline, mbedtls_rsa_context *rsa, mbedtls_ctr_drbg_context *ctr_drbg,
+  KeyPairTiming *timing, KeyPairProgressFunc progressFunc, void *progressContext) {
+
+    int ret = 0;
+
+    int64_t t0 = esp_timer_get_time();
 
 
     //printf("[INFO] Seeding random number generator\n");
 
-    mbedtls_entropy_init(&entropy);
-    if ((ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func,
-      &entropy, (const unsigned char *) extraEntropy, extraLength)) != 0) {
+    if ((ret = mbedtls_ctr_drbg_seed(ctr_drbg, f_entropy,
+      p_entropy, (const unsigned char *) extraEntropy, extraLength)) != 0) {
         printf("! mbedtls_ctr_drbg_seed=%d\n", ret);
         return -1;
     }
 
+    int64_t t1 = esp_timer_get_time();
 
     //printf("[INFO] Generating the RSA key (%ld-bit)\n", key_size);
 
-    if ((ret = mbedtls_rsa_gen_key(&rsa, mbedtls_ctr_drbg_random,
-      &ctr_drbg, key_size, EXPONENT)) != 0) {
-        printf("! mbedtls_rsa_gen_key=%d\n", ret);
-        return -2;
+    if (baseline) {
+        // The search the sieve replaced, for comparison (see
+        // keypair_generateSeeded)
+        ret = mbedtls_rsa_gen_key(rsa, mbedtls_ctr_drbg_random, ctr_drbg,
+          key_size, EXPONENT);
+        if (ret) {
+            printf("! mbedtls_rsa_gen_key=%d\n", ret);
+            return -2;
+        }
+
+    } else {
+        // Equivalent to mbedtls_rsa_gen_key, except the primes are sieved
+        // (see generatePrime) and taken from the pool when available
+        mbedtls_mpi P, Q, E, D;
+        mbedtls_mpi_init(&P);
+        mbedtls_mpi_init(&Q);
+        mbedtls_mpi_init(&E);
+        mbedtls_mpi_init(&D);
+
+        ret = mbedtls_mpi_lset(&E, EXPONENT);
+
+        PrimeProgress progress = {
+            .func = progressFunc, .context = progressContext, .primes = 0
+        };
+
+        int pooled = 0;
+        bool hasP = false;
+        while (ret == 0) {
+            progress.primes = hasP ? 1: 0;
+
+            if (!hasP) {
+                if (usePool && poolTake(&P, key_size, extraEntropy, extraLength) == 0) {
+                    pooled++;
+                } else {
+                    ret = generatePrime(&P, key_size / 2,
+                      mbedtls_ctr_drbg_random, ctr_drbg, &progress);
+                    if (ret) { break; }
+                }
+                hasP = true;
+
+                progress.primes = 1;
+                if (progressFunc) { progressFunc(1, 0, progressContext); }
+            }
+
+            if (usePool && poolTake(&Q, key_size, extraEntropy, extraLength) == 0) {
+                pooled++;
+            } else {
+                ret = generatePrime(&Q, key_size / 2,
+                  mbedtls_ctr_drbg_random, ctr_drbg, &progress);
+                if (ret) { break; }
+            }
+            if (progressFunc) { progressFunc(2, 0, progressContext); }
+
+            if (!checkPrimeDistance(&P, &Q, key_size)) { continue; }
+
+            mbedtls_rsa_free(rsa);
+            mbedtls_rsa_init(rsa);
+
+            ret = mbedtls_rsa_import(rsa, NULL, &P, &Q, NULL, &E);
+            if (ret) { break; }
+
+            ret = mbedtls_rsa_complete(rsa);
+            if (ret) { break; }
+
+            // The private exponent must be large enough (see mbedtls_rsa_gen_key)
+            ret = mbedtls_rsa_export(rsa, NULL, NULL, NULL, &D, NULL);
+            if (ret) { break; }
+            if (mbedtls_mpi_bitlen(&D) <= ((key_size + 1) / 2)) { continue; }
+
+            ret = mbedtls_rsa_check_privkey(rsa);
+            break;
+        }
+
+        mbedtls_mpi_free(&P);
+        mbedtls_mpi_free(&Q);
+        mbedtls_mpi_free(&E);
+        mbedtls_mpi_free(&D);
+
+        if (ret) {
+            printf("! keypair generate=%d\n", ret);
+            return -2;
+        }
+
+        if (usePool) { printf("? keypair used %d pooled prime(s)\n", pooled); }
     }
 
+    int64_t t2 = esp_timer_get_time();
+
 
-    if (mbedtls_rsa_export(&rsa, &keypair->N, &keypair->P,
+    if (mbedtls_rsa_export(rsa, &keypair->N, &keypair->P,
       &keypair->Q, &keypair->D, &keypair->E)) {
         printf("! could not export RSA parameters\n");
         return -3;
@@ -197,21 +628,139 @@ int keypair_generate(KeyPair *keypair, uint32_t key_size, uint8_t *extraEntropy,
     //dumpMpi("!<RSA-PUBKEY-Q=", &keypair->Q);
     //dumpMpi("!<RSA-PUBKEY-D=", &keypair->D);
 
+    if (timing) {
+        timing->seedUs = t1 - t0;
+        timing->searchUs = t2 - t1;
+        timing->exportUs = esp_timer_get_time() - t2;
+    }
 
-    ret = compute_rinv_mprime(key_size, &keypair->N, &keypair->Rb, &m_prime);
-    if (ret) { return -4; }
-    //dumpMpi("!<RSA-PUBKEY-rInv=", &keypair->Rb);
+    return 0;
+}
 
-    keypair->m_prime = m_prime;
-    //printf("!<M_prime=%lx\n", m_prime);
+static int generateKeypair(KeyPair *keypair, uint32_t key_size,
+  EntropyFunc f_entropy, void *p_entropy, uint8_t *extraEntropy,
+  size_t extraLength, bool usePool, bool baseline, KeyPairTiming *timing,
+  KeyPairProgressFunc progress, void *context) {
+
+    keypair->key_size = key_size;
+
+    mbedtls_rsa_context rsa;
+    mbedtls_ctr_drbg_context ctr_drbg;
+
+    /**
+      Public:
+        N - the RSA modulus
+        E - the public exponent
+      Private:
+        P - the first prime factor of N
+        Q - the second prime factor of N
+        D - the private exponent
+     */
+    mbedtls_ctr_drbg_init(&ctr_drbg);
+    mbedtls_rsa_init(&rsa);
+    mbedtls_mpi_init(&keypair->N);
+    mbedtls_mpi_init(&keypair->P);
+    mbedtls_mpi_init(&keypair->Q);
+    mbedtls_mpi_init(&keypair->D);
+    mbedtls_mpi_init(&keypair->E);
+
+    int ret = generate(keypair, key_size, f_entropy, p_entropy, extraEntropy,
+      extraLength, usePool, baseline, &rsa, &ctr_drbg, timing, progress, context);
 
     mbedtls_rsa_free(&rsa);
     mbedtls_ctr_drbg_free(&ctr_drbg);
+
+    if (ret) { keypair_free(keypair); }
+
+    return ret;
+}
+
+int keypair_generate(KeyPair *keypair, uint32_t key_size, uint8_t *extraEntropy,
+  size_t extraLength, KeyPairProgressFunc progress, void *context) {
+
+    // The search below has the CPU and hardware MPI to itself; the primes
+    // already pooled are still taken
+    poolHalt();
+
+    mbedtls_entropy_context entropy;
+    mbedtls_entropy_init(&entropy);
+
+    int ret = generateKeypair(keypair, key_size, mbedtls_entropy_func,
+      &entropy, extraEntropy, extraLength, true, false, NULL, progress, context);
+
     mbedtls_entropy_free(&entropy);
 
+    // Any primes left over are never used
+    keypair_poolStop();
+
+    return ret;
+}
+
+#if CONFIG_PIXIE_KEYGEN_BENCHMARK
+
+typedef struct FixedEntropy {
+    const uint8_t *seed;
+    size_t seedLength;
+    uint32_t counter;
+} FixedEntropy;
+
+// Deterministic "entropy"; the blocks SHA-256(seed || counter)
+static int fixedEntropy(void *context, unsigned char *output, size_t length) {
+    FixedEntropy *entropy = context;
+
+    while (length) {
+        uint8_t counter[4] = {
+            entropy->counter >> 24, entropy->counter >> 16,
+            entropy->counter >> 8, entropy->counter
+        };
+        entropy->counter++;
+
+        uint8_t digest[SHA256_DIGEST_SIZE];
+
+        Sha256Context ctx;
+        sha2_initSha256(&ctx);
+        sha2_updateSha256(&ctx, entropy->seed, entropy->seedLength);
+        sha2_updateSha256(&ctx, counter, sizeof(counter));
+        sha2_finalSha256(&ctx, digest);
+
+        size_t count = (length < sizeof(digest)) ? length: sizeof(digest);
+        memcpy(output, digest, count);
+        output += count;
+        length -= count;
+    }
+
     return 0;
 }
 
+int keypair_generateSeeded(KeyPair *keypair, uint32_t key_size, const uint8_t *seed,
+  size_t seedLength, bool baseline, KeyPairTiming *timing) {
+
+    FixedEntropy entropy = { .seed = seed, .seedLength = seedLength, .counter = 0 };
+
+    return generateKeypair(keypair, key_size, fixedEntropy, &entropy, NULL, 0,
+      false, baseline, timing, NULL, NULL);
+}
+
+void keypair_benchSeed(uint8_t index, uint8_t *seed) {
+    static const char *tag = "pixie-keygen-bench";
+
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, (const uint8_t*)tag, strlen(tag));
+    sha2_updateSha256(&ctx, &index, 1);
+    sha2_finalSha256(&ctx, seed);
+}
+
+#endif /* CONFIG_PIXIE_KEYGEN_BENCHMARK */
+
+void keypair_free(KeyPair *keypair) {
+    mbedtls_mpi_free(&keypair->N);
+    mbedtls_mpi_free(&keypair->P);
+    mbedtls_mpi_free(&keypair->Q);
+    mbedtls_mpi_free(&keypair->D);
+    mbedtls_mpi_free(&keypair->E);
+}
+
 /*
 void keypair_dumpKey(int block) {
     bool unused = esp_efuse_key_block_unused(block);
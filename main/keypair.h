@@ -1,8 +1,11 @@
 #ifndef __KEYPAIR_H__
 #define __KEYPAIR_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "sdkconfig.h"
+
 #include "esp_ds.h"
 
 #include "mbedtls/bignum.h"
@@ -17,19 +20,91 @@ extern "C" {
 
 #define EXPONENT 65537
 
+// The arena holding a key generation's mbedtls allocations (see arena.h).
+// Keep it at least 25% above the largest bench.arena.highWater reported
+// by BENCH-KEYGEN on a device; the host keygen-deterministic test also
+// fails if a key generation overflows it.
+#define KEYPAIR_ARENA_SIZE   (24 * 1024)
+
 
 typedef struct KeyPair {
-    mbedtls_mpi N, E, P, Q, D, Rb;
+    mbedtls_mpi N, E, P, Q, D;
     uint32_t key_size;
-    uint32_t m_prime;
 } KeyPair;
 
 
+// Phase durations of a key generation (in microseconds)
+typedef struct KeyPairTiming {
+    uint32_t seedUs;
+    uint32_t searchUs;
+    uint32_t exportUs;
+} KeyPairTiming;
+
+
+// Called during the prime search each time a candidate fails, with the
+// primes found so far (of 2, including pooled primes) and the candidates
+// tested for the current one
+typedef void (*KeyPairProgressFunc)(uint32_t primes, uint32_t candidates, void *context);
+
+// The expected number of candidates tested per prime; the sieve leaves
+// ~11.5% of odd 1536-bit candidates, 1 in ~532 of which is prime
+#define KEYPAIR_EXPECTED_CANDIDATES   (61)
+
+
 void keypair_dumpMpi(char *header, mbedtls_mpi* value);
-int keypair_generate(KeyPair *keypair, uint32_t key_size, uint8_t *entropy, size_t entropyLength);
+
+// Generates a keypair, taking any pooled primes and then stopping the
+// pool (see keypair_poolStop); progress may be NULL
+int keypair_generate(KeyPair *keypair, uint32_t key_size, uint8_t *entropy,
+  size_t entropyLength, KeyPairProgressFunc progress, void *context);
+
+#if CONFIG_PIXIE_KEYGEN_BENCHMARK
+// Number of seeds in the fixed benchmark corpus
+#define KEYPAIR_BENCH_SEEDS  (8)
+
+#define KEYPAIR_BENCH_SEED_LENGTH  (32)
+
+// Deterministically generates a keypair from seed, bypassing the prime
+// pool; the key is NOT secret, and is only useful for benchmarking. With
+// baseline, the primes are searched for by mbedtls_rsa_gen_key instead of
+// the sieve, for comparison (the key differs).
+int keypair_generateSeeded(KeyPair *keypair, uint32_t key_size, const uint8_t *seed,
+  size_t seedLength, bool baseline, KeyPairTiming *timing);
+
+// Seed index of the benchmark corpus, SHA-256("pixie-keygen-bench" || index);
+// shared by BENCH-KEYGEN and the host benchmark, so runs are comparable
+void keypair_benchSeed(uint8_t index, uint8_t *seed);
+#endif /* CONFIG_PIXIE_KEYGEN_BENCHMARK */
+
+// Starts a low-priority task which searches for primes in the background,
+// which keypair_generate will use if seeded with the same entropy
+int keypair_poolStart(uint32_t key_size, uint8_t *entropy, size_t entropyLength);
+
+// Re-seeds the background search, discarding any primes already found
+void keypair_poolStir(uint8_t *entropy, size_t entropyLength);
+
+// Stops the background search for good, freeing the task and any pooled
+// primes; once a key is generated (which stops it too) or burned, the
+// pool is never used again
+void keypair_poolStop();
+
+// Frees the MPIs of a generated keypair (which are zeroized by mbedtls)
+void keypair_free(KeyPair *keypair);
+
+// Derives the DS parameters (M, Y, Rb, M_prime and length) from the keypair
 int keypair_getParams(KeyPair *keypair, esp_ds_p_data_t *params);
 void keypair_dumpKey(int slot);
 
+// Computes RR = R^2 mod N (R = 2^k, for a k-bit N), which the hardware
+// MPI needs for Montgomery multiplication; store it alongside the pubkey
+// so verification needs no per-boot setup. Values are big-endian.
+int keypair_computeRR(const uint8_t *pubkeyN, uint8_t *rr, size_t length);
+
+// Computes message = signature^65537 mod N using the cached RR (see
+// keypair_computeRR). Values are big-endian, of length bytes.
+int keypair_verify(const uint8_t *pubkeyN, const uint8_t *rr,
+  const uint8_t *signature, uint8_t *message, size_t length);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
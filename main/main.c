@@ -1,26 +1,68 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "esp_ds.h"
 #include "esp_efuse.h"
+#include "esp_hmac.h"
 #include "esp_random.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "arena.h"
+#include "attest.h"
+#include "delegate.h"
 #include "keypair.h"
+#include "selftest.h"
+#include "session.h"
 #include "sha2.h"
+#include "signer.h"
 #include "utils.h"
 
+#if !CONFIG_PIXIE_HEADLESS
+#include "image.h"
+
 #include "firefly-display.h"
 #include "firefly-scene.h"
 
 #include "image-logo.h"
+#endif /* !CONFIG_PIXIE_HEADLESS */
 
 #define DEVICE_INFO_BLOCK   (EFUSE_BLK3)
 #define ATTEST_SLOT         (2)
 #define ATTEST_KEY_BLOCK    (EFUSE_BLK_KEY2)
 #define ATTEST_HMAC_KEY     (HMAC_KEY2)
 
+// A key set aside for CHALLENGE-HMAC; the host registers it with
+// SET-HMAC-KEY during provisioning and BURN writes it
+#define CHALLENGE_SLOT          (3)
+#define CHALLENGE_KEY_BLOCK     (EFUSE_BLK_KEY3)
+#define CHALLENGE_HMAC_KEY      (HMAC_KEY3)
+#define CHALLENGE_NONCE_LENGTH  (16)
+
+void status_set(const char *text, int progress);
+uint32_t status_redrawTime();
+
+#if !CONFIG_PIXIE_HEADLESS
+void splash_dumpStats();
+#endif /* !CONFIG_PIXIE_HEADLESS */
+
+// Boot phase timestamps (microseconds since boot); reported with the
+// first READY, and as info lines from the REPL (the display's once it is
+// up, since the display task never prints)
+typedef struct BootTimes {
+    uint32_t app;
+    uint32_t nvs;
+    uint32_t signer;
+    uint32_t display;
+} BootTimes;
+
+static BootTimes boot = { 0 };
+
 // Device Info
 // - reg0 (0x 01 00 00 ZZ)
 //   - version 0x01
@@ -67,6 +109,47 @@ int readBuffer(uint8_t *dst, char *buffer, size_t length) {
     return 0;
 }
 
+// The most challenges in one ATTEST-N or ATTEST-MERKLE; more than fit in
+// the REPL buffer
+#define MAX_CHALLENGES   (256)
+
+// Each challenge in a list is 16 nibbles, separated by commas
+#define CHALLENGE_ITEM_LENGTH   (2 * ATTEST_CHALLENGE_LENGTH + 1)
+
+// Reads a comma-separated list of challenges (for ATTEST-N and
+// ATTEST-MERKLE), printing any error for command; returns the count, or
+// -1 if invalid
+int parseChallenges(const char *command, char *buffer, int length,
+  uint8_t challenges[][ATTEST_CHALLENGE_LENGTH], int max) {
+
+    if (length <= 0 || (length + 1) % CHALLENGE_ITEM_LENGTH) {
+        printf("! %s bad parameter length (%d)\n", command, length);
+        return -1;
+    }
+
+    int count = (length + 1) / CHALLENGE_ITEM_LENGTH;
+    if (count > max) {
+        printf("! %s too many challenges (%d > %d)\n", command, count, max);
+        return -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        char *item = &buffer[i * CHALLENGE_ITEM_LENGTH];
+
+        if (i > 0 && item[-1] != ',') {
+            printf("! %s challenge %d not comma separated\n", command, i);
+            return -1;
+        }
+
+        if (readBuffer(challenges[i], item, 2 * ATTEST_CHALLENGE_LENGTH)) {
+            printf("! %s challenge %d invalid data\n", command, i);
+            return -1;
+        }
+    }
+
+    return count;
+}
+
 int stir(uint8_t *dst, size_t dstLen, uint8_t* src, size_t srcLen) {
     uint8_t digest[SHA256_DIGEST_SIZE];
     esp_fill_random(digest, sizeof(digest));
@@ -148,6 +231,165 @@ int dumpNvs(nvs_handle_t nvs, char *key, size_t length) {
     return olen;
 }
 
+#if CONFIG_PIXIE_KEYGEN_BENCHMARK
+
+// Generates a key for each seed in the fixed corpus (see
+// keypair_benchSeed), reporting the time spent in each phase, along with
+// the prime search time of mbedtls_rsa_gen_key (which the sieve replaced)
+void bench_keygen() {
+    uint64_t total[5] = { 0 };
+    uint64_t baselineTotal = 0;
+
+    // The worst case over the corpus, for sizing KEYPAIR_ARENA_SIZE
+    size_t arenaHighWater = 0, arenaFallbacks = 0;
+
+    for (uint8_t i = 0; i < KEYPAIR_BENCH_SEEDS; i++) {
+        uint8_t seed[KEYPAIR_BENCH_SEED_LENGTH];
+        keypair_benchSeed(i, seed);
+
+        KeyPair keypair = { 0 };
+        KeyPairTiming timing = { 0 };
+
+        int ret = keypair_generateSeeded(&keypair, KEY_SIZE, seed, sizeof(seed), true,
+          &timing);
+        if (ret) { panic("failed to generate RSA key", ret); }
+        keypair_free(&keypair);
+
+        uint32_t baselineUs = timing.searchUs;
+        baselineTotal += baselineUs;
+
+        ret = arena_begin(KEYPAIR_ARENA_SIZE);
+        if (ret) { printf("? BENCH-KEYGEN arena unavailable (code=%d)\n", ret); }
+
+        ret = keypair_generateSeeded(&keypair, KEY_SIZE, seed, sizeof(seed), false,
+          &timing);
+        if (ret) { panic("failed to generate RSA key", ret); }
+
+        uint8_t pubkeyN[384];
+        mbedtls_mpi_write_binary(&keypair.N, pubkeyN, sizeof(pubkeyN));
+
+        int64_t t0 = esp_timer_get_time();
+
+        esp_ds_p_data_t params = { 0 };
+        ret = keypair_getParams(&keypair, &params);
+        if (ret) { panic("failed to generate RSA key", ret); }
+
+        int64_t t1 = esp_timer_get_time();
+
+        // Not part of any phase (the arena is zeroized on release)
+        keypair_free(&keypair);
+
+        ArenaStats arenaStats = { 0 };
+        arena_end(&arenaStats);
+        if (arenaStats.highWater > arenaHighWater) { arenaHighWater = arenaStats.highWater; }
+        arenaFallbacks += arenaStats.fallbacks;
+
+        // The iv and key are fixed too; the benchmark key is never secret
+        uint8_t iv[16] = { 0 };
+        uint8_t key[32] = { 0 };
+
+        int64_t t2 = esp_timer_get_time();
+
+        esp_ds_data_t encParams = { 0 };
+        ret = esp_ds_encrypt_params(&encParams, iv, &params, key);
+        if (ret) { panic("failed to encrypt params", ret); }
+
+        int64_t t3 = esp_timer_get_time();
+
+        uint32_t timings[5] = {
+            timing.seedUs, timing.searchUs, timing.exportUs,
+            (uint32_t)(t1 - t0), (uint32_t)(t3 - t2)
+        };
+        for (int j = 0; j < 5; j++) { total[j] += timings[j]; }
+
+        printf("? bench %d: baseline=%luus seed=%luus search=%luus export=%luus params=%luus encrypt=%luus\n",
+          i, baselineUs, timings[0], timings[1], timings[2], timings[3], timings[4]);
+
+        // Allows confirming the run was deterministic
+        printf("<bench.%d.", i);
+        dumpBuffer("pubkey.N=", pubkeyN, 8);
+    }
+
+    printf("<bench.seeds=%d\n", KEYPAIR_BENCH_SEEDS);
+    printf("<bench.baseline=%llu\n", baselineTotal / KEYPAIR_BENCH_SEEDS);
+    printf("<bench.seed=%llu\n", total[0] / KEYPAIR_BENCH_SEEDS);
+    printf("<bench.search=%llu\n", total[1] / KEYPAIR_BENCH_SEEDS);
+    printf("<bench.export=%llu\n", total[2] / KEYPAIR_BENCH_SEEDS);
+    printf("<bench.params=%llu\n", total[3] / KEYPAIR_BENCH_SEEDS);
+    printf("<bench.encrypt=%llu\n", total[4] / KEYPAIR_BENCH_SEEDS);
+    printf("<bench.arena.size=%d\n", KEYPAIR_ARENA_SIZE);
+    printf("<bench.arena.highWater=%d\n", arenaHighWater);
+    printf("<bench.arena.fallbacks=%d\n", arenaFallbacks);
+}
+
+#endif /* CONFIG_PIXIE_KEYGEN_BENCHMARK */
+
+// Prints any missing prerequisites for an attestation command
+bool checkAttestReady(const char *command, uint32_t modelNumber,
+  uint32_t serialNumber, bool hasPubKey, bool hasCipherdata, bool hasAttest) {
+
+    bool ready = true;
+
+    if (modelNumber == 0) {
+        printf("! %s no model number present (use SET-MODEL or LOAD-EFUSE)\n", command);
+        ready = false;
+    }
+
+    if (serialNumber == 0) {
+        printf("! %s no serial number present (use SET-MODEL or LOAD-EFUSE)\n", command);
+        ready = false;
+    }
+
+    if (!hasPubKey) {
+        printf("! %s no pubkey present (use GEN-KEY, LOAD-NVS or SET-PUBKEYN)\n", command);
+        ready = false;
+    }
+
+    if (!hasCipherdata) {
+        printf("! %s no cipherdata present (use GEN-KEY, LOAD-NVS or SET-CIPHERDATA)\n", command);
+        ready = false;
+    }
+
+    if (!hasAttest) {
+        printf("! %s no attest present (use SET-ATTEST or LOAD-NVS)\n", command);
+        ready = false;
+    }
+
+    return ready;
+}
+
+// GEN-KEY reports progress at most this often while searching for
+// primes (in microseconds), as each redraw briefly preempts it (see
+// keygen_progress)
+#define KEYGEN_PROGRESS_INTERVAL   (1000 * 1000)
+
+typedef struct KeygenProgress {
+    int64_t lastUpdate;
+    int lastPercent;
+} KeygenProgress;
+
+// The prime search is the first 70% of GEN-KEY, 35% per prime. Within a
+// prime, progress is estimated from the candidates tested, approaching
+// (but never reaching) the next 35% at the expected number of candidates.
+static void keygen_progress(uint32_t primes, uint32_t candidates, void *context) {
+    KeygenProgress *progress = context;
+
+    int percent = 35 * primes + (35 * candidates) /
+      (candidates + KEYPAIR_EXPECTED_CANDIDATES);
+    if (percent == progress->lastPercent) { return; }
+
+    // Always show a prime being found; otherwise throttle
+    int64_t now = esp_timer_get_time();
+    if (candidates && now - progress->lastUpdate < KEYGEN_PROGRESS_INTERVAL) { return; }
+
+    progress->lastUpdate = now;
+    progress->lastPercent = percent;
+
+    // The status task runs just above the REPL, so this redraws at once
+    // (pausing the search for one frame) without ever waiting on it
+    status_set("Generating key", percent);
+}
+
 void provision_repl(nvs_handle_t nvs) {
     int ret = 0;
     printf("? start provisioning\n");
@@ -170,15 +412,76 @@ void provision_repl(nvs_handle_t nvs) {
     uint8_t entropy[32];
     esp_fill_random(entropy, sizeof(entropy));
 
+    // Never persisted (see SessionState); only held until BURN
+    uint8_t hmacKey[32] = { 0 };
+    bool hasHmacKey = false;
+
     uint32_t modelNumber = 0;
     uint32_t serialNumber = 0;
 
     uint32_t randMarker = esp_random();
 
+    // Restore any state persisted across a quick reset (see PERSIST)
+    SessionState session = { 0 };
+    bool persist = false;
+    {
+        int bootCount = session_restore(&session);
+        if (bootCount) {
+            persist = true;
+
+            modelNumber = session.modelNumber;
+            serialNumber = session.serialNumber;
+            randMarker = session.randMarker;
+
+            // The cipherdata is bound to the key, which is never persisted,
+            // so unless the key was burned it cannot be used anymore
+            if (session.hasCipherdata && esp_efuse_key_block_unused(ATTEST_KEY_BLOCK)) {
+                printf("? session cipherdata discarded; key was not burned\n");
+                session.hasCipherdata = false;
+                session.hasPubKey = false;
+            }
+
+            if (session.hasPubKey) {
+                memcpy(pubkeyN, session.pubkeyN, sizeof(pubkeyN));
+                hasPubKey = true;
+            }
+
+            if (session.hasCipherdata) {
+                memcpy(cipherdata, session.cipherdata, sizeof(cipherdata));
+                signer_setCipherdata(cipherdata);
+                hasCipherdata = true;
+            }
+
+            if (session.hasAttest) {
+                memcpy(attest, session.attest, sizeof(attest));
+                hasAttest = true;
+            }
+
+            printf("? restored session (boot=%d)\n", bootCount);
+        }
+    }
+
+    attest_setDevice(modelNumber, serialNumber, pubkeyN, attest);
+
+    // Set by any command which modifies the session state
+    bool dirty = false;
+
+    // Begin searching for primes while waiting on the host, unless the
+    // device is already provisioned and will never need GEN-KEY
+    if (esp_efuse_key_block_unused(ATTEST_KEY_BLOCK)) {
+        ret = keypair_poolStart(KEY_SIZE, entropy, sizeof(entropy));
+        if (ret) { printf("! failed to start prime pool (code=%d)\n", ret); }
+    }
 
     // Begin accepting input from the provisioning service
 
     int readyCount = 0;
+    bool announced = false, commanded = false;
+#if !CONFIG_PIXIE_HEADLESS
+    bool displayReported = false;
+#endif /* !CONFIG_PIXIE_HEADLESS */
+
+    status_set("Waiting for host", -1);
 
     char buffer[4096];
 
@@ -192,12 +495,31 @@ void provision_repl(nvs_handle_t nvs) {
         // in case the provision script missed the first message
         if (readyCount == 0) {
             readyCount++;
-            printf("<READY\n");
+            if (announced) {
+                printf("<READY\n");
+            } else {
+                // The display may still be coming up (display=0)
+                uint32_t now = esp_timer_get_time();
+                printf("<READY app=%lu nvs=%lu signer=%lu display=%lu ready=%lu\n",
+                  boot.app, boot.nvs, boot.signer, boot.display, now);
+                printf("? boot app at %luus, nvs at %luus, signer at %luus, ready at %luus\n",
+                  boot.app, boot.nvs, boot.signer, now);
+                announced = true;
+            }
         } else if (readyCount > 0) {
             readyCount++;
             if (readyCount * portTICK_PERIOD_MS >= 4999) { readyCount = 0; }
         }
 
+#if !CONFIG_PIXIE_HEADLESS
+        // The display comes up below the REPL's priority; report it from
+        // here, between responses
+        if (!displayReported && boot.display) {
+            printf("? boot display ready at %luus\n", boot.display);
+            displayReported = true;
+        }
+#endif /* !CONFIG_PIXIE_HEADLESS */
+
         // Not enough space left in the buffer; purge it
         if (sizeof(buffer) - offset - 1 < 1) {
             printf("! buffer exceeded length, purging\n");
@@ -220,6 +542,13 @@ void provision_repl(nvs_handle_t nvs) {
         if (length == 0) { continue; }
 
         // Got data; no longer announcing we're ready
+        if (readyCount != -1) {
+            if (!commanded) {
+                printf("? boot first command at %luus\n", (uint32_t)esp_timer_get_time());
+                commanded = true;
+            }
+            status_set("Provisioning", -1);
+        }
         readyCount = -1;
 
         offset += length;
@@ -249,95 +578,185 @@ void provision_repl(nvs_handle_t nvs) {
             if (startsWith(buffer, "ATTEST=", i)) {
                 bool error = false;
 
-                if (length != 16) {
-                    printf("! ATTEST bad parameter length (%d != 16)\n", length);
+                if (length != 2 * ATTEST_CHALLENGE_LENGTH) {
+                    printf("! ATTEST bad parameter length (%d != %d)\n", length,
+                      2 * ATTEST_CHALLENGE_LENGTH);
                     error = true;
                 }
 
-                if (modelNumber == 0) {
-                    printf("! ATTEST no model number present (use SET-MODEL or LOAD-EFUSE)\n");
+                if (!checkAttestReady("ATTEST", modelNumber, serialNumber,
+                  hasPubKey, hasCipherdata, hasAttest)) {
                     error = true;
                 }
 
-                if (serialNumber == 0) {
-                    printf("! ATTEST no serial number present (use SET-MODEL or LOAD-EFUSE)\n");
-                    error = true;
-                }
+                if (error) {
+                    printf("<ERROR\n");
 
-                if (!hasPubKey) {
-                    printf("! ATTEST no pubkey present (use GEN-KEY, LOAD-NVS or SET-PUBKEYN)\n");
-                    error = true;
+                    offset = 0;
+                    buffer[0] = 0;
+                    break;
                 }
 
-                if (!hasCipherdata) {
-                    printf("! ATTEST no cipherdata present (use GEN-KEY, LOAD-NVS or SET-CIPHERDATA)\n");
+
+                uint8_t challenge[ATTEST_CHALLENGE_LENGTH];
+                ret = readBuffer(challenge, &buffer[start], length);
+                if (ret < 0) { panic("! ATTEST invalid data", ret); }
+
+                // The template already contains the device block
+                uint8_t message[ATTEST_SIGNATURE_LENGTH];
+                attest_prepare(challenge, message);
+
+                ret = signer_start(message);
+                if (ret) { panic("! ATTEST failed to start signing", ret); }
+
+                uint8_t *attestation = attest_template();
+
+                // While the DS peripheral signs, stream the known prefix
+                printf("<attest=");
+                dumpHex(attestation, ATTEST_SIGNATURE_OFFSET);
+
+                uint8_t *signature = &attestation[ATTEST_SIGNATURE_OFFSET];
+                ret = signer_finish(signature);
+                if (ret) { panic("! ATTEST failed to sign", ret); }
+
+                reverseBytes(signature, ATTEST_SIGNATURE_LENGTH);
+                dumpHex(signature, ATTEST_SIGNATURE_LENGTH);
+                printf(" (%d bytes)\n", ATTEST_LENGTH);
+
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "ATTEST-COMPACT=", i)) {
+                bool error = false;
+
+                if (length != 2 * ATTEST_CHALLENGE_LENGTH) {
+                    printf("! ATTEST-COMPACT bad parameter length (%d != %d)\n", length,
+                      2 * ATTEST_CHALLENGE_LENGTH);
                     error = true;
                 }
 
-                if (!hasAttest) {
-                    printf("! ATTEST no attest present (use SET-ATTEST or LOAD-NVS)\n");
+                if (!checkAttestReady("ATTEST-COMPACT", modelNumber, serialNumber,
+                  hasPubKey, hasCipherdata, hasAttest)) {
                     error = true;
                 }
 
                 if (error) {
                     printf("<ERROR\n");
 
-                    offset = 0;
-                    buffer[0] = 0;
+                    offset = 0; buffer[0] = 0;
                     break;
                 }
 
+                uint8_t challenge[ATTEST_CHALLENGE_LENGTH];
+                ret = readBuffer(challenge, &buffer[start], length);
+                if (ret < 0) { panic("! ATTEST-COMPACT invalid data", ret); }
 
-                size_t nLen = KEY_SIZE / 8;
+                // The compact template already contains the key ID
+                uint8_t message[ATTEST_SIGNATURE_LENGTH];
+                attest_prepareCompact(challenge, message);
 
-                uint8_t attestation[
-                    1 +               // version
-                    7 +               // random nonce
-                    (length / 2) +    // provided timestamp
-                    4 + 4 +           // model nunmber + serial number
-                    nLen +            // pubkey.N
-                    sizeof(attest) +  // attest
-                    nLen              // signature
-                ];
-                memset(attestation, 0, sizeof(attestation));
+                ret = signer_start(message);
+                if (ret) { panic("! ATTEST-COMPACT failed to start signing", ret); }
 
-                size_t offset = 0;
+                uint8_t *attestation = attest_compactTemplate();
 
-                attestation[offset++] = 0x01;
+                // While the DS peripheral signs, stream the known prefix
+                printf("<attest=");
+                dumpHex(attestation, ATTEST_COMPACT_SIGNATURE_OFFSET);
 
-                esp_fill_random(&attestation[offset], 7);
-                offset += 7;
+                uint8_t *signature = &attestation[ATTEST_COMPACT_SIGNATURE_OFFSET];
+                ret = signer_finish(signature);
+                if (ret) { panic("! ATTEST-COMPACT failed to sign", ret); }
 
-                ret = readBuffer(&attestation[offset], &buffer[start], length);
-                if (ret < 0) { panic("! ATTEST invalid data", ret); }
-                offset += length / 2;
+                reverseBytes(signature, ATTEST_SIGNATURE_LENGTH);
+                dumpHex(signature, ATTEST_SIGNATURE_LENGTH);
+                printf(" (%d bytes)\n", ATTEST_COMPACT_LENGTH);
+
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "ATTEST-MERKLE=", i)) {
+                bool error = false;
+
+                uint8_t challenges[MAX_CHALLENGES][ATTEST_CHALLENGE_LENGTH];
+                int count = parseChallenges("ATTEST-MERKLE", &buffer[start], length,
+                  challenges, MAX_CHALLENGES);
+                if (count < 0) { error = true; }
+
+                if (!checkAttestReady("ATTEST-MERKLE", modelNumber, serialNumber,
+                  hasPubKey, hasCipherdata, hasAttest)) {
+                    error = true;
+                }
+
+                if (error) {
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                // The tree; leaves first, followed by each level up to
+                // the root. A node without a sibling is promoted as-is,
+                // which adds at most one node per level (hence the + 16).
+                //   leaf = sha256(0x00 || challenge)
+                //   node = sha256(0x01 || left || right)
+                uint8_t tree[2 * count + 16][SHA256_DIGEST_SIZE];
+
+                for (int j = 0; j < count; j++) {
+                    uint8_t prefix = 0x00;
+
+                    Sha256Context ctx;
+                    sha2_initSha256(&ctx);
+                    sha2_updateSha256(&ctx, &prefix, 1);
+                    sha2_updateSha256(&ctx, challenges[j], ATTEST_CHALLENGE_LENGTH);
+                    sha2_finalSha256(&ctx, tree[j]);
+                }
+
+                int root = 0;
+                {
+                    int level = 0, width = count, next = count;
+                    while (width > 1) {
+                        for (int j = 0; j < width; j += 2) {
+                            if (j + 1 == width) {
+                                memcpy(tree[next++], tree[level + j], SHA256_DIGEST_SIZE);
+                                continue;
+                            }
+
+                            uint8_t prefix = 0x01;
+
+                            Sha256Context ctx;
+                            sha2_initSha256(&ctx);
+                            sha2_updateSha256(&ctx, &prefix, 1);
+                            sha2_updateSha256(&ctx, tree[level + j], SHA256_DIGEST_SIZE);
+                            sha2_updateSha256(&ctx, tree[level + j + 1], SHA256_DIGEST_SIZE);
+                            sha2_finalSha256(&ctx, tree[next++]);
+                        }
+                        level += width;
+                        width = (width + 1) / 2;
+                    }
+                    root = level;
+                }
 
-                //uint32_t model = esp_efuse_read_reg(EFUSE_BLK3, 1);
-                attestation[offset++] = (modelNumber >> 24) & 0xff;
-                attestation[offset++] = (modelNumber >> 16) & 0xff;
-                attestation[offset++] = (modelNumber >> 8) & 0xff;
-                attestation[offset++] = (modelNumber >> 0) & 0xff;
+                uint8_t attestation[ATTEST_MERKLE_LENGTH];
+                memset(attestation, 0, sizeof(attestation));
 
-                //uint32_t serial = esp_efuse_read_reg(EFUSE_BLK3, 2);
-                attestation[offset++] = (serialNumber >> 24) & 0xff;
-                attestation[offset++] = (serialNumber >> 16) & 0xff;
-                attestation[offset++] = (serialNumber >> 8) & 0xff;
-                attestation[offset++] = (serialNumber >> 0) & 0xff;
+                attestation[ATTEST_VERSION_OFFSET] = ATTEST_MERKLE_VERSION;
 
+                esp_fill_random(&attestation[ATTEST_NONCE_OFFSET], ATTEST_NONCE_LENGTH);
 
-                memcpy(&attestation[offset], pubkeyN, nLen);
-                offset += nLen;
+                {
+                    uint8_t *data = &attestation[ATTEST_MERKLE_COUNT_OFFSET];
+                    data[0] = (count >> 24) & 0xff;
+                    data[1] = (count >> 16) & 0xff;
+                    data[2] = (count >> 8) & 0xff;
+                    data[3] = (count >> 0) & 0xff;
+                }
 
-                //size_t olen = 384;
-                //nvs_get_blob(nvs, "pubkey-n", &attestation[offset], &olen);
-                //offset += nLen;
+                memcpy(&attestation[ATTEST_MERKLE_ROOT_OFFSET], tree[root],
+                  ATTEST_MERKLE_ROOT_LENGTH);
 
-                memcpy(&attestation[offset], attest, 64);
-                offset += 64;
+                memcpy(&attestation[ATTEST_MERKLE_DEVICE_OFFSET],
+                  &attest_template()[ATTEST_DEVICE_OFFSET], ATTEST_DEVICE_LENGTH);
 
-                //olen = 64;
-                //nvs_get_blob(nvs, "attest", &attestation[offset], &olen);
-                //offset += olen;
+                size_t offset = ATTEST_MERKLE_SIGNATURE_OFFSET;
 
                 Sha256Context ctx;
                 sha2_initSha256(&ctx);
@@ -345,16 +764,190 @@ void provision_repl(nvs_handle_t nvs) {
                 sha2_finalSha256(&ctx, &attestation[offset]);
                 reverseBytes(&attestation[offset], 32);
 
-                esp_ds_data_t *encParams = heap_caps_malloc(sizeof(esp_ds_data_t), MALLOC_CAP_DMA);
-                memcpy((uint8_t*)encParams, cipherdata, sizeof(esp_ds_data_t));
+                ret = signer_start(&attestation[offset]);
+                if (ret) { panic("! ATTEST-MERKLE failed to start signing", ret); }
+
+                // While the DS peripheral signs, output the inclusion path
+                // of each leaf; the sibling at each level, if any
+                printf("<attest.count=%d\n", count);
+                for (int j = 0; j < count; j++) {
+                    printf("<attest.path.%d=", j);
+
+                    size_t pathLength = 0;
+
+                    int level = 0, width = count, index = j;
+                    while (width > 1) {
+                        int sibling = index ^ 1;
+                        if (sibling < width) {
+                            dumpHex(tree[level + sibling], SHA256_DIGEST_SIZE);
+                            pathLength += SHA256_DIGEST_SIZE;
+                        }
+                        level += width;
+                        width = (width + 1) / 2;
+                        index >>= 1;
+                    }
+
+                    printf(" (%d bytes)\n", pathLength);
+                }
+
+                printf("<attest=");
+                dumpHex(attestation, offset);
+
+                ret = signer_finish(&attestation[offset]);
+                if (ret) { panic("! ATTEST-MERKLE failed to sign", ret); }
+
+                reverseBytes(&attestation[offset], ATTEST_SIGNATURE_LENGTH);
+                dumpHex(&attestation[offset], ATTEST_SIGNATURE_LENGTH);
+                printf(" (%d bytes)\n", ATTEST_MERKLE_LENGTH);
+
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "ATTEST-N=", i)) {
+                bool error = false;
+
+                uint8_t challenges[MAX_CHALLENGES][ATTEST_CHALLENGE_LENGTH];
+                int count = parseChallenges("ATTEST-N", &buffer[start], length,
+                  challenges, MAX_CHALLENGES);
+                if (count < 0) { error = true; }
+
+                if (!checkAttestReady("ATTEST-N", modelNumber, serialNumber,
+                  hasPubKey, hasCipherdata, hasAttest)) {
+                    error = true;
+                }
+
+                if (error) {
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                // The static device block, shared by each proof
+                uint8_t *device = &attest_template()[ATTEST_DEVICE_OFFSET];
+                dumpBuffer("<attest.device=", device, ATTEST_DEVICE_LENGTH);
+                printf("<attest.count=%d\n", count);
+
+                // Each item is the nonce, challenge and signature; the
+                // previous item is output while the next is being signed
+                const size_t sigOffset = ATTEST_NONCE_LENGTH + ATTEST_CHALLENGE_LENGTH;
+                uint8_t items[2][sigOffset + ATTEST_SIGNATURE_LENGTH];
+
+                for (int j = 0; j <= count; j++) {
+                    uint8_t *item = items[j & 1];
+
+                    if (j < count) {
+                        esp_fill_random(item, ATTEST_NONCE_LENGTH);
+                        memcpy(&item[ATTEST_NONCE_LENGTH], challenges[j],
+                          ATTEST_CHALLENGE_LENGTH);
+
+                        // Same payload as ATTEST
+                        uint8_t version = ATTEST_VERSION;
+
+                        uint8_t message[ATTEST_SIGNATURE_LENGTH] = { 0 };
+
+                        Sha256Context ctx;
+                        sha2_initSha256(&ctx);
+                        sha2_updateSha256(&ctx, &version, 1);
+                        sha2_updateSha256(&ctx, item, sigOffset);
+                        sha2_updateSha256(&ctx, device, ATTEST_DEVICE_LENGTH);
+                        sha2_finalSha256(&ctx, message);
+                        reverseBytes(message, SHA256_DIGEST_SIZE);
+
+                        ret = signer_start(message);
+                        if (ret) { panic("! ATTEST-N failed to start signing", ret); }
+                    }
+
+                    if (j > 0) {
+                        printf("<attest.%d", j - 1);
+                        dumpBuffer("=", items[(j - 1) & 1], sizeof(items[0]));
+                    }
+
+                    if (j < count) {
+                        ret = signer_finish(&item[sigOffset]);
+                        if (ret) { panic("! ATTEST-N failed to sign", ret); }
+                        reverseBytes(&item[sigOffset], ATTEST_SIGNATURE_LENGTH);
+                    }
+                }
+
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "ATTEST-SESSION=", i)) {
+                bool error = false;
+
+                if (length != 2 * ATTEST_CHALLENGE_LENGTH) {
+                    printf("! ATTEST-SESSION bad parameter length (%d != %d)\n", length,
+                      2 * ATTEST_CHALLENGE_LENGTH);
+                    error = true;
+                }
+
+                if (!checkAttestReady("ATTEST-SESSION", modelNumber, serialNumber,
+                  hasPubKey, hasCipherdata, hasAttest)) {
+                    error = true;
+                }
+
+                if (error) {
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                uint8_t challenge[ATTEST_CHALLENGE_LENGTH];
+                ret = readBuffer(challenge, &buffer[start], length);
+                if (ret < 0) { panic("! ATTEST-SESSION invalid data", ret); }
+
+                // The only DS signature; once per boot (or device change)
+                bool created = false;
+                if (!delegate_ready()) {
+                    ret = delegate_begin();
+                    if (ret) { panic("! ATTEST-SESSION failed to delegate", ret); }
+                    created = true;
+                }
+
+                // The host only needs the certificate once; it can be
+                // fetched again using ATTEST-SESSION-CERT
+                uint8_t certId[SHA256_DIGEST_SIZE];
+                {
+                    Sha256Context ctx;
+                    sha2_initSha256(&ctx);
+                    sha2_updateSha256(&ctx, delegate_certificate(), DELEGATE_CERT_LENGTH);
+                    sha2_finalSha256(&ctx, certId);
+                }
+                dumpBuffer("<attest.certId=", certId, sizeof(certId));
+
+                if (created) {
+                    dumpBuffer("<attest.cert=", (uint8_t*)delegate_certificate(),
+                      DELEGATE_CERT_LENGTH);
+                }
+
+                uint8_t item[DELEGATE_ITEM_LENGTH];
+                ret = delegate_sign(challenge, item);
+                if (ret) { panic("! ATTEST-SESSION failed to sign", ret); }
+
+                dumpBuffer("<attest=", item, sizeof(item));
+
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "ATTEST-SESSION-CERT", i)) {
+                if (!delegate_ready()) {
+                    printf("! ATTEST-SESSION-CERT no session key (use ATTEST-SESSION)\n");
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                dumpBuffer("<attest.cert=", (uint8_t*)delegate_certificate(),
+                  DELEGATE_CERT_LENGTH);
 
-                ret = esp_ds_sign(&attestation[offset], encParams,
-                  ATTEST_HMAC_KEY, &attestation[offset]);
-                reverseBytes(&attestation[offset], nLen);
-                dumpBuffer("<attest=", attestation, sizeof(attestation));
+                printf("<OK\n");
 
+#if CONFIG_PIXIE_KEYGEN_BENCHMARK
+            } else if (startsWith(buffer, "BENCH-KEYGEN", i)) {
+                bench_keygen();
                 printf("<OK\n");
 
+#endif /* CONFIG_PIXIE_KEYGEN_BENCHMARK */
             } else if (startsWith(buffer, "BURN", i)) {
                 ret = esp_efuse_batch_write_begin();
                 if (ret) { panic("failed efuse batch begin", ret); }
@@ -372,12 +965,91 @@ void provision_repl(nvs_handle_t nvs) {
                 ret = esp_efuse_write_key(ATTEST_KEY_BLOCK,
                   ESP_EFUSE_KEY_PURPOSE_HMAC_DOWN_DIGITAL_SIGNATURE, key, 32);
                 if (ret) { panic("failed to write key", ret); }
+
+                if (hasHmacKey) {
+                    ret = esp_efuse_write_key(CHALLENGE_KEY_BLOCK,
+                      ESP_EFUSE_KEY_PURPOSE_HMAC_UP, hmacKey, sizeof(hmacKey));
+                    if (ret) { panic("failed to write hmac key", ret); }
+
+                    memset(hmacKey, 0, sizeof(hmacKey));
+                    hasHmacKey = false;
+                }
+
+                // No further key can be used, so no primes are needed
+                keypair_poolStop();
+
+                status_set("eFuses burned", -1);
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "CHALLENGE-HMAC=", i)) {
+                bool error = false;
+
+                if (length != 2 * CHALLENGE_NONCE_LENGTH) {
+                    printf("! CHALLENGE-HMAC bad parameter length (%d != %d)\n",
+                      length, 2 * CHALLENGE_NONCE_LENGTH);
+                    error = true;
+                }
+
+                if (esp_efuse_key_block_unused(CHALLENGE_KEY_BLOCK)) {
+                    printf("! CHALLENGE-HMAC no key burned (use SET-HMAC-KEY and BURN)\n");
+                    error = true;
+                }
+
+                if (error) {
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                // The MAC covers the burned model and serial number,
+                // followed by the host nonce
+                uint8_t message[8 + CHALLENGE_NONCE_LENGTH];
+                uint32_t model = esp_efuse_read_reg(DEVICE_INFO_BLOCK, 1);
+                uint32_t serial = esp_efuse_read_reg(DEVICE_INFO_BLOCK, 2);
+                for (int j = 0; j < 4; j++) {
+                    message[j] = (model >> (24 - 8 * j)) & 0xff;
+                    message[4 + j] = (serial >> (24 - 8 * j)) & 0xff;
+                }
+
+                // A bad nonce or a failed HMAC (e.g. the key block was burned
+                // with another purpose) is reported; neither is fatal
+                ret = readBuffer(&message[8], &buffer[start], length);
+                if (ret < 0) {
+                    printf("! CHALLENGE-HMAC invalid data\n");
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                uint8_t mac[32];
+                ret = esp_hmac_calculate(CHALLENGE_HMAC_KEY, message, sizeof(message), mac);
+                if (ret) {
+                    printf("! CHALLENGE-HMAC failed (code=%d)\n", ret);
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                dumpBuffer("<hmac=", mac, sizeof(mac));
+
                 printf("<OK\n");
 
+#if !CONFIG_PIXIE_HEADLESS
+            } else if (startsWith(buffer, "DISPLAY-STATS", i)) {
+                splash_dumpStats();
+                printf("<OK\n");
+
+#endif /* !CONFIG_PIXIE_HEADLESS */
             } else if (startsWith(buffer, "DUMP", i)) {
                 int inUse = dumpKey(ATTEST_SLOT);
                 printf("<efuse.key.burned=%d\n", inUse);
 
+                int hmacInUse = dumpKey(CHALLENGE_SLOT);
+                printf("<efuse.hmacKey.burned=%d\n", hmacInUse);
+
                 uint32_t valueCheck = 0;
                 printf("<efuse.blk3=");
                 for (int j = 0; j < 8; j++) {
@@ -396,6 +1068,7 @@ void provision_repl(nvs_handle_t nvs) {
 
                 dumpNvs(nvs, "attest", 64);
                 dumpNvs(nvs, "pubkey-n", 384);
+                dumpNvs(nvs, "pubkey-rr", 384);
                 dumpNvs(nvs, "cipherdata", sizeof(esp_ds_data_t));
 
                 if (modelNumber) {
@@ -408,6 +1081,8 @@ void provision_repl(nvs_handle_t nvs) {
 
                 printf("<pending.randMarker=%lu\n", randMarker);
 
+                printf("<pending.hmacKey=%d\n", hasHmacKey);
+
                 if (hasPubKey) {
                     dumpBuffer("<pending.pubkey.N=", pubkeyN, sizeof(pubkeyN));
                 }
@@ -420,6 +1095,8 @@ void provision_repl(nvs_handle_t nvs) {
                     dumpBuffer("<pending.attest=", attest, sizeof(attest));
                 }
 
+                printf("<session.persist=%d\n", persist);
+
                 printf("<ready=%d\n", (inUse || valueCheck));
 
                 printf("<OK\n");
@@ -436,37 +1113,61 @@ void provision_repl(nvs_handle_t nvs) {
                 }
 
                 printf("? starting key generation (%d-bit)\n", KEY_SIZE);
+                status_set("Generating key", 0);
+
+                // All mbedtls allocations for the keypair are scoped to
+                // the arena, which is zeroized and released once done
+                ret = arena_begin(KEYPAIR_ARENA_SIZE);
+                if (ret) { printf("? GEN-KEY arena unavailable (code=%d)\n", ret); }
 
                 // Create an RSA keypair
+                uint32_t t0 = ticks();
+                uint32_t redrawUs = status_redrawTime();
                 KeyPair keypair = { 0 };
-                ret = keypair_generate(&keypair, KEY_SIZE, entropy, sizeof(entropy));
+                KeygenProgress progress = { .lastUpdate = 0, .lastPercent = 0 };
+                ret = keypair_generate(&keypair, KEY_SIZE, entropy, sizeof(entropy),
+                  keygen_progress, &progress);
                 if (ret) { panic("failed to generate RSA key", ret); }
+                printf("? key generation took %lums (%luus in status redraws)\n",
+                  (ticks() - t0) * portTICK_PERIOD_MS, status_redrawTime() - redrawUs);
                 keypair_dumpMpi("<pubkey.N=", &keypair.N);
                 mbedtls_mpi_write_binary(&keypair.N, pubkeyN, 384);
+                status_set("Generating key", 70);
 
                 // Convert it to the ESP format
                 esp_ds_p_data_t params = { 0 };
                 ret = keypair_getParams(&keypair, &params);
                 if (ret) { panic("failed to generate RSA key", ret); }
+                status_set("Generating key", 85);
+
+                keypair_free(&keypair);
+
+                ArenaStats arenaStats = { 0 };
+                arena_end(&arenaStats);
+                printf("? GEN-KEY arena high-water %d/%d bytes (%d fallbacks)\n",
+                  arenaStats.highWater, arenaStats.size, arenaStats.fallbacks);
                 //dumpBuffer("!PRIVATE<params=", (uint8_t*)&params, sizeof(esp_ds_p_data_t));
 
-                esp_ds_data_t *encParams = heap_caps_malloc(sizeof(esp_ds_data_t), MALLOC_CAP_DMA);
-                memset(encParams, 0, sizeof(esp_ds_data_t));
+                esp_ds_data_t encParams = { 0 };
 
                 // Encrypt it using the hardware
-                ret = esp_ds_encrypt_params(encParams, iv, &params, key);
+                ret = esp_ds_encrypt_params(&encParams, iv, &params, key);
                 if (ret) { panic("failed to encrypt params", ret); }
-                memcpy(cipherdata, encParams, sizeof(esp_ds_data_t));
+                memcpy(cipherdata, &encParams, sizeof(esp_ds_data_t));
+                signer_setCipherdata(cipherdata);
                 dumpBuffer("<cipherdata=", cipherdata, sizeof(cipherdata));
+                status_set("Key generated", 100);
 
                 hasPubKey = true;
                 hasCipherdata = true;
 
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "LOAD-EFUSE", i)) {
                 modelNumber = esp_efuse_read_reg(EFUSE_BLK3, 1);
                 serialNumber = esp_efuse_read_reg(EFUSE_BLK3, 2);
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "LOAD-NVS", i)) {
@@ -499,11 +1200,13 @@ void provision_repl(nvs_handle_t nvs) {
                     ret = nvs_get_blob(nvs, "cipherdata", blob, &olen);
                     if (!ret && olen == sizeof(esp_ds_data_t)) {
                         memcpy(cipherdata, blob, olen);
+                        signer_setCipherdata(cipherdata);
                         dumpBuffer("<nvs.cipherdata=", cipherdata, olen);
                         hasCipherdata = true;
                     }
                 }
 
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "NOP", i)) {
@@ -515,7 +1218,28 @@ void provision_repl(nvs_handle_t nvs) {
                 // @TODO: PING often gets clobbered so we need the newline;
                 //        we should proably do this for everything
 
+            } else if (startsWith(buffer, "PERSIST=", i)) {
+                ret = readNumber(&buffer[start], length);
+                if (ret != 0 && ret != 1) {
+                    printf("! PERSIST invalid value (must be 0 or 1)\n");
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                persist = ret;
+                if (persist) {
+                    dirty = true;
+                } else {
+                    session_clear();
+                }
+
+                printf("<session.persist=%d\n", ret);
+                printf("<OK\n");
+
             } else if (startsWith(buffer, "RESET", i)) {
+                status_set("Resetting", -1);
                 printf("<OK\n");
 
                 delay(1000);
@@ -536,6 +1260,7 @@ void provision_repl(nvs_handle_t nvs) {
 
                 hasAttest = true;
 
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "SET-CIPHERDATA=", i)) {
@@ -551,9 +1276,28 @@ void provision_repl(nvs_handle_t nvs) {
 
                 ret = readBuffer(cipherdata, &buffer[start], length);
                 if (ret < 0) { panic("! SET-CIPHERDATA invalid data", ret); }
+                signer_setCipherdata(cipherdata);
 
                 hasCipherdata = true;
 
+                dirty = true;
+                printf("<OK\n");
+
+            } else if (startsWith(buffer, "SET-HMAC-KEY=", i)) {
+                if (length != 2 * sizeof(hmacKey)) {
+                    printf("! SET-HMAC-KEY bad parameter length (%d != %d)\n",
+                      length, 2 * sizeof(hmacKey));
+                    printf("<ERROR\n");
+
+                    offset = 0; buffer[0] = 0;
+                    break;
+                }
+
+                ret = readBuffer(hmacKey, &buffer[start], length);
+                if (ret < 0) { panic("! SET-HMAC-KEY invalid data", ret); }
+
+                hasHmacKey = true;
+
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "SET-MODEL=", i)) {
@@ -566,6 +1310,7 @@ void provision_repl(nvs_handle_t nvs) {
                     break;
                 }
                 modelNumber = ret;
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "SET-PUBKEYN=", i)) {
@@ -583,6 +1328,7 @@ void provision_repl(nvs_handle_t nvs) {
 
                 hasPubKey = true;
 
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "SET-SERIAL=", i)) {
@@ -595,10 +1341,12 @@ void provision_repl(nvs_handle_t nvs) {
                     break;
                 }
                 serialNumber = ret;
+                dirty = true;
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "STIR-ENTROPY=", i)) {
                 stir(entropy, sizeof(entropy), (uint8_t*)&buffer[start], length);
+                keypair_poolStir(entropy, sizeof(entropy));
                 printf("<OK\n");
 
             } else if (startsWith(buffer, "STIR-IV=", i)) {
@@ -645,9 +1393,18 @@ void provision_repl(nvs_handle_t nvs) {
                 ret = nvs_set_blob(nvs, "pubkey-n", pubkeyN, sizeof(pubkeyN));
                 if (ret) { panic("failed to write pubkey-n", ret); }
 
+                // Cached for the boot self-test (see splash_verify)
+                uint8_t rr[sizeof(pubkeyN)];
+                ret = keypair_computeRR(pubkeyN, rr, sizeof(rr));
+                if (ret) { panic("failed to compute pubkey-rr", ret); }
+
+                ret = nvs_set_blob(nvs, "pubkey-rr", rr, sizeof(rr));
+                if (ret) { panic("failed to write pubkey-rr", ret); }
+
                 ret = nvs_set_blob(nvs, "cipherdata", cipherdata, sizeof(esp_ds_data_t) );
                 if (ret) { panic("failed to write cipherdata", ret); }
 
+                status_set("Written to NVS", -1);
                 printf("<OK\n");
 
             } else {
@@ -658,154 +1415,653 @@ void provision_repl(nvs_handle_t nvs) {
             offset = 0; buffer[0] = 0;
             break;
         }
+
+        // Refresh the attestation template and persist the updated
+        // session, if enabled
+        if (dirty) {
+            attest_setDevice(modelNumber, serialNumber, pubkeyN, attest);
+
+            // The session certificate covers the old device block
+            delegate_end();
+        }
+
+        if (dirty && persist) {
+            session.modelNumber = modelNumber;
+            session.serialNumber = serialNumber;
+            session.randMarker = randMarker;
+
+            session.hasPubKey = hasPubKey;
+            memcpy(session.pubkeyN, pubkeyN, sizeof(pubkeyN));
+
+            session.hasCipherdata = hasCipherdata;
+            memcpy(session.cipherdata, cipherdata, sizeof(cipherdata));
+
+            session.hasAttest = hasAttest;
+            memcpy(session.attest, attest, sizeof(attest));
+
+            session_save(&session);
+        }
+        dirty = false;
     }
 }
 
+#if CONFIG_PIXIE_HEADLESS
+
+// No display; the status is only visible in the REPL output
+void status_set(const char *text, int progress) { }
+
+uint32_t status_redrawTime() { return 0; }
+
+#else /* CONFIG_PIXIE_HEADLESS */
+
 #define DISPLAY_BUS        (FfxDisplaySpiBus2)
 #define PIN_DISPLAY_DC     (4)
 #define PIN_DISPLAY_RESET  (5)
 
-void render_scene(uint8_t *fragment, uint32_t y0, void *context) {
-    FfxScene scene = context;
-    ffx_scene_render(scene, fragment, y0, FfxDisplayFragmentHeight);
+// All text nodes share one scene; a band only renders it if the
+// vertical interval index of the text nodes finds one overlapping its
+// rows (see render_band)
+#define SPLASH_MAX_TEXT     (8)
+#define SPLASH_SCENE_NODES  (32)
+
+// firefly-scene exposes no font metrics, and ffx_scene_createText has no
+// font selection (every text node uses its one built-in font), so that
+// font's extent is kept here, as the rows above and below a text node's
+// y. Whether y is the top or the baseline of the text is not specified
+// either, so both are a full SPLASH_FONT_LINE (the largest line pitch of
+// the splash layout); culling is correct either way, at the cost of
+// rendering the scene for some bands the text does not reach. Tighten
+// these if firefly-scene gains a metrics accessor.
+#define SPLASH_FONT_LINE     (30)
+#define SPLASH_FONT_ASCENT   (SPLASH_FONT_LINE)
+#define SPLASH_FONT_DESCENT  (SPLASH_FONT_LINE)
+
+// The status overlay (text and progress bar); only the bands it covers
+// are re-rendered on update, the rest are replayed from a cache. The
+// status text at STATUS_TOP may reach up to SPLASH_FONT_ASCENT above it.
+#define STATUS_TOP         (212)
+#define STATUS_OVERLAY_TOP (STATUS_TOP - SPLASH_FONT_ASCENT)
+#define STATUS_BAR_X       (10)
+#define STATUS_BAR_Y       (234)
+#define STATUS_BAR_WIDTH   (220)
+#define STATUS_BAR_HEIGHT  (4)
+#define STATUS_BAR_COLOR   (0xffff)
+
+#define SPLASH_WIDTH       (240)
+#define SPLASH_HEIGHT      (240)
+
+// The static content is a solid background with the compressed logo
+// (main/image-logo.h; see scripts/build-image.mjs) decoded on top, a
+// row at a time, straight into each band
+#define SPLASH_BACKGROUND_COLOR  (0x0000)
+#define SPLASH_LOGO_X            (82)
+#define SPLASH_LOGO_Y            (10)
+
+#define SPLASH_MAX_BANDS   (32)
+
+// A text node and the rows [top, bottom) it may cover; maxBottom is the
+// largest bottom of this and all previous entries
+typedef struct SplashText {
+    FfxNode node;
+    int32_t top;
+    int32_t bottom;
+    int32_t maxBottom;
+} SplashText;
+
+// Reported by DISPLAY-STATS; times are in microseconds, and the min and
+// max are per fragment
+typedef struct SplashStats {
+    // Set once the first frame is on the display (see splash_task)
+    uint32_t readyUs;
+    bool overlay;
+
+    uint32_t frames;
+    uint32_t frameUs;
+    uint32_t fragments;
+    uint32_t cachedFragments;
+    uint32_t textRendered;
+    uint32_t renderUs;
+    uint32_t renderMinUs;
+    uint32_t renderMaxUs;
+    uint32_t transferUs;
+    uint32_t transferMinUs;
+    uint32_t transferMaxUs;
+    uint32_t badRows;
+
+    // Status redraws (since boot), and the time spent in them; the time
+    // any task they preempted (e.g. GEN-KEY) lost to them
+    uint32_t statusFrames;
+    uint32_t statusUs;
+} SplashStats;
+
+typedef struct SplashContext {
+    nvs_handle_t nvs;
+
+    // The scene holding every text node, and the vertical interval
+    // index of those nodes; sorted by top
+    FfxScene scene;
+    SplashText text[SPLASH_MAX_TEXT];
+    int32_t textCount;
+
+    FfxDisplayContext display;
+    FfxNode verifyText;
+    char strVerify[20];
+
+    // Held while modifying the scene or rendering a frame
+    SemaphoreHandle_t lock;
+
+    // Given once the first frame is on the display
+    SemaphoreHandle_t shown;
+
+    // Bands above the status overlay, as image tokens; valid until the
+    // static content changes (see splash_invalidate)
+    uint16_t *cache[SPLASH_MAX_BANDS];
+
+    // The REPL's priority; the status task runs just above it, so a
+    // redraw briefly preempts whatever the REPL is doing (see status_task)
+    UBaseType_t priority;
+
+    // The status overlay; status_set only touches the pending copy, so
+    // it never waits on a frame
+    TaskHandle_t statusTask;
+    SemaphoreHandle_t statusLock;
+    FfxNode statusText;
+    char strStatus[32];
+    int32_t progress;
+    char pendingStatus[32];
+    int32_t pendingProgress;
+
+    // Per frame timing (in microseconds); only touched while rendering
+    uint32_t fragments;
+    uint32_t cachedFragments;
+    uint32_t textRendered;
+    uint32_t renderUs;
+    uint32_t transferUs;
+    uint32_t callbackUs;
+    uint32_t renderMinUs;
+    uint32_t renderMaxUs;
+    uint32_t transferMinUs;
+    uint32_t transferMaxUs;
+
+    // Logo rows which failed to decode (since boot)
+    uint32_t badRows;
+
+    // The last frame's timing, published under the statusLock; rendering
+    // never prints, since it shares the console with the REPL
+    SplashStats stats;
+} SplashContext;
+
+static SplashContext splash = { 0 };
+
+static void splash_invalidate(SplashContext *ctx) {
+    for (int i = 0; i < SPLASH_MAX_BANDS; i++) {
+        free(ctx->cache[i]);
+        ctx->cache[i] = NULL;
+    }
 }
 
-void splash_screen(nvs_handle_t nvs) {
+// Adds a text node at (x, y) to the scene, indexing the rows it may cover
+static FfxNode splash_addText(SplashContext *ctx, const char *data, size_t length,
+  int32_t x, int32_t y) {
 
-    FfxScene scene = ffx_scene_init(128);
+    if (ctx->textCount == SPLASH_MAX_TEXT) { panic("too many splash text nodes", 0); }
 
-    FfxDisplayContext display = ffx_display_init(DISPLAY_BUS, PIN_DISPLAY_DC,
-      PIN_DISPLAY_RESET, FfxDisplayRotationRibbonRight, render_scene, scene);
+    FfxNode text = ffx_scene_createText(ctx->scene, data, length);
+    ffx_scene_appendChild(ffx_scene_root(ctx->scene), text);
 
-    // Blank screen
-    while (!ffx_display_renderFragment(display));
+    FfxPoint *point = ffx_scene_nodePosition(text);
+    point->x = x;
+    point->y = y;
 
-    FfxNode root = ffx_scene_root(scene);
+    int32_t top = y - SPLASH_FONT_ASCENT;
+    int32_t bottom = y + SPLASH_FONT_DESCENT;
 
-    FfxNode fill = ffx_scene_createFill(scene, ffx_color_rgb(0, 0, 0, 0x20));
-    ffx_scene_appendChild(root, fill);
+    int i = ctx->textCount++;
+    while (i > 0 && ctx->text[i - 1].top > top) {
+        ctx->text[i] = ctx->text[i - 1];
+        i--;
+    }
 
-    {
-        FfxNode logo = ffx_scene_createImage(scene, image_logo, sizeof(image_logo));
-        ffx_scene_appendChild(root, logo);
-        FfxPoint *point = ffx_scene_nodePosition(logo);
-        point->x = 82;
-        point->y = 10;
+    ctx->text[i].node = text;
+    ctx->text[i].top = top;
+    ctx->text[i].bottom = bottom;
+
+    int32_t maxBottom = 0;
+    for (i = 0; i < ctx->textCount; i++) {
+        if (ctx->text[i].bottom > maxBottom) { maxBottom = ctx->text[i].bottom; }
+        ctx->text[i].maxBottom = maxBottom;
     }
 
-    char strModel[20];
-    char strSerial[20];
-    char strVerify[20];
+    return text;
+}
 
-   {
-        uint32_t model = esp_efuse_read_reg(EFUSE_BLK3, 1);
-        if ((model >> 8) == 1) {
-            snprintf(strModel, sizeof(strModel), "Pixie (rev.%ld)", model & 0xff);
+static void render_addTime(SplashContext *ctx, uint32_t renderUs) {
+    ctx->renderUs += renderUs;
+    if (renderUs < ctx->renderMinUs) { ctx->renderMinUs = renderUs; }
+    if (renderUs > ctx->renderMaxUs) { ctx->renderMaxUs = renderUs; }
+}
+
+// Fills the background and decodes the logo rows the band covers,
+// compositing the text and status on top
+static void render_band(SplashContext *ctx, uint8_t *fragment, uint32_t y0) {
+    int64_t t0 = esp_timer_get_time();
+
+    uint16_t *pixels = (uint16_t*)fragment;
+
+    uint32_t rows = FfxDisplayFragmentHeight;
+    if (y0 + rows > SPLASH_HEIGHT) { rows = SPLASH_HEIGHT - y0; }
+
+    uint32_t band = y0 / FfxDisplayFragmentHeight;
+    bool overlay = (y0 + rows > STATUS_OVERLAY_TOP);
+    bool cacheable = (!overlay && band < SPLASH_MAX_BANDS);
+
+    if (cacheable && ctx->cache[band]) {
+        const uint16_t *tokens = ctx->cache[band];
+        for (int y = 0; tokens && y < rows; y++) {
+            tokens = image_decodeTokens(tokens, SPLASH_WIDTH, &pixels[y * SPLASH_WIDTH]);
+        }
+
+        if (tokens) {
+            ctx->cachedFragments++;
+            render_addTime(ctx, esp_timer_get_time() - t0);
+            return;
+        }
+
+        // A corrupt entry; drop it and render the band again (which
+        // re-caches it)
+        free(ctx->cache[band]);
+        ctx->cache[band] = NULL;
+    }
+
+    uint32_t logoWidth = 0, logoHeight = 0;
+    if (image_getSize(image_logo, &logoWidth, &logoHeight) ||
+      SPLASH_LOGO_X + logoWidth > SPLASH_WIDTH) {
+        logoHeight = 0;
+    }
+
+    for (int y = 0; y < rows; y++) {
+        uint16_t *row = &pixels[y * SPLASH_WIDTH];
+        for (int x = 0; x < SPLASH_WIDTH; x++) { row[x] = SPLASH_BACKGROUND_COLOR; }
+
+        int32_t logoY = y0 + y - SPLASH_LOGO_Y;
+        if (logoY < 0 || logoY >= (int32_t)logoHeight) { continue; }
+
+        if (image_decodeRow(image_logo, logoY, &row[SPLASH_LOGO_X])) {
+            // Never leave a partially decoded row behind
+            for (uint32_t x = 0; x < logoWidth; x++) {
+                row[SPLASH_LOGO_X + x] = SPLASH_BACKGROUND_COLOR;
+            }
+            ctx->badRows++;
+        }
+    }
+
+    // The index is sorted by top and maxBottom never decreases, so the
+    // first node which may overlap is found by binary search, and the
+    // scan ends at the first node starting below the band. firefly-scene
+    // only renders a whole scene, so the scene is rendered once if any
+    // node overlaps, and skipped otherwise.
+    int32_t top = y0, bottom = top + FfxDisplayFragmentHeight;
+    int lo = 0, hi = ctx->textCount;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (ctx->text[mid].maxBottom <= top) {
+            lo = mid + 1;
         } else {
-            snprintf(strModel, sizeof(strModel), "Model: unknown (%ld)", model);
+            hi = mid;
         }
-        FfxNode text = ffx_scene_createText(scene, strModel, strlen(strModel));
-        ffx_scene_appendChild(root, text);
-        FfxPoint *point = ffx_scene_nodePosition(text);
-        point->x = 10;
-        point->y = 130;
     }
 
-    {
-        uint32_t serial = esp_efuse_read_reg(EFUSE_BLK3, 2);
-        snprintf(strSerial, sizeof(strSerial), "S/N: %ld", serial);
-        FfxNode text = ffx_scene_createText(scene, strSerial, strlen(strSerial));
-        ffx_scene_appendChild(root, text);
-        FfxPoint *point = ffx_scene_nodePosition(text);
-        point->x = 10;
-        point->y = 160;
+    bool hasText = false;
+    for (int i = lo; !hasText && i < ctx->textCount && ctx->text[i].top < bottom; i++) {
+        hasText = (ctx->text[i].bottom > top);
     }
 
-    {
-        esp_ds_data_t *cipherdata = heap_caps_malloc(sizeof(esp_ds_data_t), MALLOC_CAP_DMA);
-        memset(cipherdata, 0, sizeof(esp_ds_data_t));
+    if (hasText) {
+        ffx_scene_render(ctx->scene, fragment, y0, FfxDisplayFragmentHeight);
+        ctx->textRendered++;
+    }
+
+    if (overlay && ctx->progress >= 0) {
+        uint32_t width = STATUS_BAR_WIDTH * ctx->progress / 100;
+        for (int y = 0; y < rows; y++) {
+            if (y0 + y < STATUS_BAR_Y || y0 + y >= STATUS_BAR_Y + STATUS_BAR_HEIGHT) {
+                continue;
+            }
+            uint16_t *row = &pixels[y * SPLASH_WIDTH + STATUS_BAR_X];
+            for (int x = 0; x < width; x++) { row[x] = STATUS_BAR_COLOR; }
+        }
+    }
 
-        size_t olen = sizeof(esp_ds_data_t);
-        nvs_get_blob(nvs, "cipherdata", cipherdata, &olen);
+    if (cacheable) {
+        uint16_t *tokens = malloc(rows * (SPLASH_WIDTH + 1) * sizeof(uint16_t));
+        if (tokens) {
+            size_t length = 0;
+            for (int y = 0; y < rows; y++) {
+                length += image_encodeTokens(&pixels[y * SPLASH_WIDTH], SPLASH_WIDTH,
+                  &tokens[length]);
+            }
+            uint16_t *shrunk = realloc(tokens, length * sizeof(uint16_t));
+            ctx->cache[band] = shrunk ? shrunk: tokens;
+        }
+    }
 
-        uint8_t digest[384];
-        memset(digest, 0x42, sizeof(digest));
-        digest[0] = 0xff;
-        //esp_fill_random(digest, 384);
+    render_addTime(ctx, esp_timer_get_time() - t0);
+}
 
-        uint8_t sig[384];
-        memset(sig, 0, sizeof(sig));
+// Bands are rendered in the display callback, straight into the
+// fragment the driver sends next; the driver owns its fragment buffers
+// and exposes no way to queue one rendered ahead, so a render-ahead task
+// would always cost a copy per band
+void render_splash(uint8_t *fragment, uint32_t y0, void *context) {
+    SplashContext *ctx = context;
 
-        int ret = esp_ds_sign(digest, cipherdata, ATTEST_HMAC_KEY, sig);
+    int64_t t0 = esp_timer_get_time();
 
-        reverseBytes(digest, sizeof(digest));
+    render_band(ctx, fragment, y0);
 
-        mbedtls_mpi mpiResult, mpiSig, mpiE, mpiN, mpiRR;
+    ctx->fragments++;
+    ctx->callbackUs += esp_timer_get_time() - t0;
+}
 
-        mbedtls_mpi_init(&mpiResult);
-        mbedtls_mpi_init(&mpiSig);
-        mbedtls_mpi_init(&mpiE);
-        mbedtls_mpi_init(&mpiN);
-        mbedtls_mpi_init(&mpiRR);
+// Must be called with the lock held
+static void render_frame(SplashContext *ctx) {
+    ffx_scene_sequence(ctx->scene);
 
-        reverseBytes(sig, sizeof(sig));
-        mbedtls_mpi_read_binary(&mpiSig, sig, sizeof(sig));
+    ctx->fragments = 0;
+    ctx->cachedFragments = 0;
+    ctx->textRendered = 0;
+    ctx->renderUs = 0;
+    ctx->renderMinUs = UINT32_MAX;
+    ctx->renderMaxUs = 0;
+    ctx->transferUs = 0;
+    ctx->transferMinUs = UINT32_MAX;
+    ctx->transferMaxUs = 0;
 
-        uint8_t n[384];
-        olen = 384;
-        nvs_get_blob(nvs, "pubkey-n", n, &olen);
-        mbedtls_mpi_read_binary(&mpiN, n, olen);
+    int64_t start = esp_timer_get_time();
 
-        mbedtls_mpi_read_string(&mpiE, 10, "65537");
+    while (1) {
+        ctx->callbackUs = 0;
 
-        mbedtls_mpi_exp_mod(&mpiResult, &mpiSig, &mpiE, &mpiN, &mpiRR);
+        int64_t t0 = esp_timer_get_time();
+        uint32_t frameDone = ffx_display_renderFragment(ctx->display);
 
-        uint8_t result[384];
-        mbedtls_mpi_write_binary(&mpiResult, result, sizeof(result));
+        // Whatever was not spent in the callback was spent transferring
+        uint32_t transferUs = esp_timer_get_time() - t0 - ctx->callbackUs;
+        ctx->transferUs += transferUs;
+        if (transferUs < ctx->transferMinUs) { ctx->transferMinUs = transferUs; }
+        if (transferUs > ctx->transferMaxUs) { ctx->transferMaxUs = transferUs; }
 
-        int miss = -1;
-        for (int i = 0; i < sizeof(result); i++) {
-            if (result[i] != digest[i]) {
-                miss = 0;
-                break;
-            }
-        }
+        if (frameDone) { break; }
+    }
 
-        if (miss >= 0) {
-            snprintf(strVerify, sizeof(strVerify), "Verify: bad %d", miss);
-        } else {
-            snprintf(strVerify, sizeof(strVerify), "Verify: ok");
-        }
+    uint32_t frameUs = esp_timer_get_time() - start;
+
+    xSemaphoreTake(ctx->statusLock, portMAX_DELAY);
+    SplashStats *stats = &ctx->stats;
+    stats->frames++;
+    stats->frameUs = frameUs;
+    stats->fragments = ctx->fragments;
+    stats->cachedFragments = ctx->cachedFragments;
+    stats->textRendered = ctx->textRendered;
+    stats->renderUs = ctx->renderUs;
+    stats->renderMinUs = ctx->renderMinUs;
+    stats->renderMaxUs = ctx->renderMaxUs;
+    stats->transferUs = ctx->transferUs;
+    stats->transferMinUs = ctx->transferMinUs;
+    stats->transferMaxUs = ctx->transferMaxUs;
+    stats->badRows = ctx->badRows;
+    xSemaphoreGive(ctx->statusLock);
+}
 
-        FfxNode text = ffx_scene_createText(scene, strVerify, strlen(strVerify));
-        ffx_scene_appendChild(root, text);
-        FfxPoint *point = ffx_scene_nodePosition(text);
-        point->x = 10;
-        point->y = 190;
+// Reports the last frame's timing; called from the REPL, which owns the
+// console
+void splash_dumpStats() {
+    SplashStats stats = { 0 };
+    if (splash.statusLock) {
+        xSemaphoreTake(splash.statusLock, portMAX_DELAY);
+        stats = splash.stats;
+        xSemaphoreGive(splash.statusLock);
     }
 
-    TickType_t lastFrameTime = ticks();
+    printf("<display.ready=%lu\n", stats.readyUs);
+    printf("<display.overlay=%d\n", stats.overlay);
+    printf("<display.frames=%lu\n", stats.frames);
+    printf("<display.frame=%lu\n", stats.frameUs);
+    printf("<display.fragments=%lu\n", stats.fragments);
+    printf("<display.cached=%lu\n", stats.cachedFragments);
+    printf("<display.text=%lu\n", stats.textRendered);
+    printf("<display.render=%lu\n", stats.renderUs);
+    printf("<display.render.min=%lu\n", stats.frames ? stats.renderMinUs: 0);
+    printf("<display.render.max=%lu\n", stats.renderMaxUs);
+    printf("<display.transfer=%lu\n", stats.transferUs);
+    printf("<display.transfer.min=%lu\n", stats.frames ? stats.transferMinUs: 0);
+    printf("<display.transfer.max=%lu\n", stats.transferMaxUs);
+    printf("<display.badRows=%lu\n", stats.badRows);
+    printf("<display.status.frames=%lu\n", stats.statusFrames);
+    printf("<display.status.time=%lu\n", stats.statusUs);
+}
 
-    ffx_scene_sequence(scene);
+// Redraws the frame whenever the status changes (or after the self-test).
+// This runs just above the REPL's priority, so a long computation on the
+// REPL (e.g. GEN-KEY, whose prime search never yields) is paused for one
+// frame per update instead of starving the display; callers throttle
+// their updates accordingly.
+//
+// firefly-display has no partial window update, so every redraw sends
+// the whole frame; only the bands from STATUS_OVERLAY_TOP are rendered,
+// and the rest are decoded from the band cache (see render_band). The cost is
+// reported by DISPLAY-STATS (display.status.time).
+static void status_task(void *arg) {
+    SplashContext *ctx = arg;
 
     while (1) {
-        uint32_t frameDone = ffx_display_renderFragment(display);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-        if (frameDone) {
-            //ffx_scene_sequence(scene);
-            break;
-            /*
-            BaseType_t didDelay = xTaskDelayUntil(&lastFrameTime, 1000 / 60);
-            if (didDelay == pdFALSE) {
-                delay(1);
-                lastFrameTime = xTaskGetTickCount();
-            }
-            */
+        int64_t t0 = esp_timer_get_time();
+
+        xSemaphoreTake(ctx->lock, portMAX_DELAY);
+
+        xSemaphoreTake(ctx->statusLock, portMAX_DELAY);
+        memcpy(ctx->strStatus, ctx->pendingStatus, sizeof(ctx->strStatus));
+        ctx->progress = ctx->pendingProgress;
+        xSemaphoreGive(ctx->statusLock);
+
+        ffx_scene_textSetText(ctx->statusText, ctx->strStatus, strlen(ctx->strStatus));
+
+        render_frame(ctx);
+
+        xSemaphoreGive(ctx->lock);
+
+        xSemaphoreTake(ctx->statusLock, portMAX_DELAY);
+        ctx->stats.statusFrames++;
+        ctx->stats.statusUs += esp_timer_get_time() - t0;
+        xSemaphoreGive(ctx->statusLock);
+    }
+}
+
+// Shows the status text and progress (0 to 100, or -1 for none); the
+// redraw happens on the status task, and this never waits for it
+void status_set(const char *text, int progress) {
+    if (splash.statusLock == NULL) { return; }
+
+    xSemaphoreTake(splash.statusLock, portMAX_DELAY);
+    snprintf(splash.pendingStatus, sizeof(splash.pendingStatus), "%s", text);
+    splash.pendingProgress = progress;
+    xSemaphoreGive(splash.statusLock);
+
+    // Before the display is up, the first frame picks this up
+    if (splash.statusTask) { xTaskNotifyGive(splash.statusTask); }
+}
+
+// The total time spent in status redraws (in microseconds, since boot)
+uint32_t status_redrawTime() {
+    if (splash.statusLock == NULL) { return 0; }
+
+    xSemaphoreTake(splash.statusLock, portMAX_DELAY);
+    uint32_t result = splash.stats.statusUs;
+    xSemaphoreGive(splash.statusLock);
+
+    return result;
+}
+
+// Runs the DS self-test off the boot path, then updates the splash
+// with the result
+static void selftest_task(void *arg) {
+    SplashContext *context = arg;
+
+    bool cached = false;
+    int ret = selftest_run(context->nvs, ATTEST_KEY_BLOCK, ATTEST_HMAC_KEY, &cached);
+
+    // The self-test may finish before the display is up
+    xSemaphoreTake(context->shown, portMAX_DELAY);
+
+    xSemaphoreTake(context->lock, portMAX_DELAY);
+
+    if (ret) {
+        snprintf(context->strVerify, sizeof(context->strVerify), "Verify: bad %d", ret);
+    } else {
+        snprintf(context->strVerify, sizeof(context->strVerify), "Verify: ok");
+    }
+    ffx_scene_textSetText(context->verifyText, context->strVerify,
+      strlen(context->strVerify));
+
+    splash_invalidate(context);
+
+    xSemaphoreGive(context->lock);
+
+    if (context->statusTask) { xTaskNotifyGive(context->statusTask); }
+
+    vTaskDelete(NULL);
+}
+
+// Brings up the display and renders the first frame, concurrently with
+// the rest of boot (see splash_start)
+static void splash_task(void *arg) {
+    bool provisioned = (bool)(uintptr_t)arg;
+
+    xSemaphoreTake(splash.lock, portMAX_DELAY);
+
+    // The background and logo are drawn directly (see render_band), so
+    // the scene only contains the text
+    splash.scene = ffx_scene_init(SPLASH_SCENE_NODES);
+
+    FfxDisplayContext display = ffx_display_init(DISPLAY_BUS, PIN_DISPLAY_DC,
+      PIN_DISPLAY_RESET, FfxDisplayRotationRibbonRight, render_splash, &splash);
+
+    static char strModel[20];
+    static char strSerial[20];
+
+    {
+        uint32_t model = esp_efuse_read_reg(EFUSE_BLK3, 1);
+        if ((model >> 8) == 1) {
+            snprintf(strModel, sizeof(strModel), "Pixie (rev.%ld)", model & 0xff);
+        } else {
+            snprintf(strModel, sizeof(strModel), "Model: unknown (%ld)", model);
         }
+        splash_addText(&splash, strModel, strlen(strModel), 10, 130);
+    }
+
+    {
+        uint32_t serial = esp_efuse_read_reg(EFUSE_BLK3, 2);
+        snprintf(strSerial, sizeof(strSerial), "S/N: %ld", serial);
+        splash_addText(&splash, strSerial, strlen(strSerial), 10, 160);
     }
+
+    splash.display = display;
+
+    {
+        // Sized for the final result; updated by selftest_task
+        snprintf(splash.strVerify, sizeof(splash.strVerify), "%s",
+          provisioned ? "Verify: ...": "Not provisioned");
+        FfxNode text = splash_addText(&splash, splash.strVerify,
+          sizeof(splash.strVerify), 10, 190);
+        ffx_scene_textSetText(text, splash.strVerify, strlen(splash.strVerify));
+        splash.verifyText = text;
+    }
+
+    {
+        // Sized for the longest status; updated by status_task
+        FfxNode text = splash_addText(&splash, splash.strStatus,
+          sizeof(splash.strStatus), 10, STATUS_TOP);
+        splash.statusText = text;
+
+        // Include any status set while the display was coming up
+        xSemaphoreTake(splash.statusLock, portMAX_DELAY);
+        memcpy(splash.strStatus, splash.pendingStatus, sizeof(splash.strStatus));
+        splash.progress = splash.pendingProgress;
+        xSemaphoreGive(splash.statusLock);
+
+        ffx_scene_textSetText(text, splash.strStatus, strlen(splash.strStatus));
+    }
+
+    render_frame(&splash);
+
+    xSemaphoreGive(splash.lock);
+
+    boot.display = esp_timer_get_time();
+
+    xTaskCreate(status_task, "status", 4096, &splash, splash.priority + 1,
+      &splash.statusTask);
+
+    // Nothing here prints, since the REPL may be mid-response; these are
+    // reported by DISPLAY-STATS (and the display time by the first READY)
+    xSemaphoreTake(splash.statusLock, portMAX_DELAY);
+    splash.stats.readyUs = boot.display;
+    splash.stats.overlay = (splash.statusTask != NULL);
+    xSemaphoreGive(splash.statusLock);
+
+    // Catch any status change which raced the first frame
+    if (splash.statusTask) { xTaskNotifyGive(splash.statusTask); }
+
+    xSemaphoreGive(splash.shown);
+
+    vTaskDelete(NULL);
 }
 
+// Starts bringing up the display in the background; status_set may be
+// used immediately
+void splash_start(bool provisioned) {
+    splash.progress = -1;
+    splash.pendingProgress = -1;
+    splash.priority = uxTaskPriorityGet(NULL);
+
+    splash.lock = xSemaphoreCreateMutex();
+    splash.statusLock = xSemaphoreCreateMutex();
+    splash.shown = xSemaphoreCreateBinary();
+    if (splash.lock == NULL || splash.statusLock == NULL || splash.shown == NULL) {
+        panic("failed to allocate splash locks", 0);
+    }
+
+    // Below the REPL, so bringing up the display only uses the time the
+    // REPL spends waiting for input, and never delays a command
+    UBaseType_t priority = splash.priority;
+    if (priority > tskIDLE_PRIORITY) { priority--; }
+
+    BaseType_t status = xTaskCreate(splash_task, "display", 8192,
+      (void*)(uintptr_t)provisioned, priority, NULL);
+    if (status != pdPASS) { panic("failed to start display", status); }
+}
+
+// Starts the self-test, whose result is shown once the display is up
+void splash_verify(nvs_handle_t nvs) {
+    splash.nvs = nvs;
+
+    BaseType_t status = xTaskCreate(selftest_task, "selftest", 8192, &splash,
+      tskIDLE_PRIORITY + 1, NULL);
+    if (status != pdPASS) { printf("! failed to start self-test\n"); }
+}
+
+#endif /* CONFIG_PIXIE_HEADLESS */
+
 void app_main() {
+    boot.app = esp_timer_get_time();
+
+#if !CONFIG_PIXIE_HEADLESS
+    // The display comes up in its own task, while NVS is opened and the
+    // REPL starts listening
+    uint32_t version = esp_efuse_read_reg(EFUSE_BLK3, 0);
+    splash_start(version != 0);
+#endif /* !CONFIG_PIXIE_HEADLESS */
 
     int ret = nvs_flash_init_partition("attest");
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -819,8 +2075,18 @@ void app_main() {
         panic("failed to open attest partition", ret);
     }
 
-    uint32_t version = esp_efuse_read_reg(EFUSE_BLK3, 0);
-    if (version) { splash_screen(nvs); }
+    boot.nvs = esp_timer_get_time();
+
+    ret = signer_init(ATTEST_HMAC_KEY);
+    if (ret) {
+        panic("failed to allocate signer", ret);
+    }
+
+    boot.signer = esp_timer_get_time();
+
+#if !CONFIG_PIXIE_HEADLESS
+    if (version) { splash_verify(nvs); }
+#endif /* !CONFIG_PIXIE_HEADLESS */
 
     provision_repl(nvs);
 
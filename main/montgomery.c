@@ -0,0 +1,77 @@
+#include <stdbool.h>
+
+#include "montgomery.h"
+
+
+// Rb = 2^(2k) mod M, for a k-bit M (i.e. with its top bit set). Since
+// M < 2^k < 2M, start from 2^k mod M = 2^k - M and double it k more
+// times, subtracting M whenever the result reaches M.
+int montgomery_computeRb(const uint32_t *M, uint32_t *Rb, size_t words) {
+    if (words == 0 || (M[words - 1] >> 31) == 0 || (M[0] & 1) == 0) {
+        return -1;
+    }
+
+    // Rb = 2^k - M = ~M + 1
+    uint64_t carry = 1;
+    for (size_t i = 0; i < words; i++) {
+        carry += (uint32_t)~M[i];
+        Rb[i] = carry;
+        carry >>= 32;
+    }
+
+    for (size_t bit = 0; bit < words * 32; bit++) {
+
+        // Rb <<= 1
+        uint32_t top = Rb[words - 1] >> 31;
+        for (size_t i = words - 1; i > 0; i--) {
+            Rb[i] = (Rb[i] << 1) | (Rb[i - 1] >> 31);
+        }
+        Rb[0] <<= 1;
+
+        // If Rb >= M, then Rb -= M
+        bool reduce = top;
+        if (!reduce) {
+            reduce = true;
+            for (size_t i = words; i > 0; i--) {
+                if (Rb[i - 1] != M[i - 1]) {
+                    reduce = (Rb[i - 1] > M[i - 1]);
+                    break;
+                }
+            }
+        }
+
+        if (reduce) {
+            int64_t borrow = 0;
+            for (size_t i = 0; i < words; i++) {
+                borrow += (int64_t)Rb[i] - M[i];
+                Rb[i] = borrow;
+                borrow >>= 32;
+            }
+        }
+    }
+
+    // Self-check; Rb must be fully reduced
+    for (size_t i = words; i > 0; i--) {
+        if (Rb[i - 1] != M[i - 1]) {
+            return (Rb[i - 1] < M[i - 1]) ? 0: -2;
+        }
+    }
+
+    return -2;
+}
+
+// M' = -M^-1 mod 2^32, using Newton iteration on the low word; an odd m
+// is its own inverse mod 2^3, and each iteration doubles the correct bits
+int montgomery_computeMPrime(uint32_t m0, uint32_t *mprime) {
+    if ((m0 & 1) == 0) { return -1; }
+
+    uint32_t inv = m0;
+    for (int i = 0; i < 4; i++) { inv *= 2 - m0 * inv; }
+
+    *mprime = -inv;
+
+    // Self-check; M * M' == -1 mod 2^32
+    if ((uint32_t)(m0 * *mprime) != 0xffffffff) { return -2; }
+
+    return 0;
+}
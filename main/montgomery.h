@@ -0,0 +1,44 @@
+#ifndef __MONTGOMERY_H__
+#define __MONTGOMERY_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// Montgomery parameters for a modulus M, as the DS peripheral (and the
+// hardware MPI) expect them. These are pure integer math, so are also
+// built on the host (see host/test). The python equivalent code:
+//
+//    key_size = private_key.key_size # in bits
+//
+//    # calculate rinv == Rb
+//    rr = 1 << (key_size * 2)
+//    rinv = rr % pub_numbers.n # RSA r inverse operand
+//
+//    # calculate MPrime
+//    a = rsa._modinv(M, 1 << 32)
+//    mprime = (a * -1) & 0xFFFFFFFF # RSA M prime operand
+//
+// See: https://github.com/espressif/esp_secure_cert_mgr/issues/8
+
+
+// Computes Rb = 2^(2k) mod M for a k-bit M (k = 32 * words, so the top
+// bit must be set), with M and Rb as little-endian words. Returns 0 on
+// success, -1 if M is not an odd k-bit modulus, or -2 if the result
+// failed its self-check.
+int montgomery_computeRb(const uint32_t *M, uint32_t *Rb, size_t words);
+
+// Computes M' = -M^-1 mod 2^32 from the low word of M. Returns 0 on
+// success, -1 if M is even, or -2 if the result failed its self-check.
+int montgomery_computeMPrime(uint32_t m0, uint32_t *mprime);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __MONTGOMERY_H__ */
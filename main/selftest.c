@@ -0,0 +1,117 @@
+#include <string.h>
+
+#include "selftest.h"
+
+#include "esp_heap_caps.h"
+
+#include "keypair.h"
+#include "sha2.h"
+#include "utils.h"
+
+
+// The digest of the last state which passed
+#define CACHE_KEY    "selftest"
+
+
+static void computeDigest(const uint8_t *cipherdata, const uint8_t *pubkeyN,
+  esp_efuse_block_t keyBlock, uint8_t *digest) {
+
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, cipherdata, sizeof(esp_ds_data_t));
+    sha2_updateSha256(&ctx, pubkeyN, 384);
+
+    // The device info and the key block state (the key itself is read
+    // protected, but can only ever be burned once)
+    for (int i = 0; i < 8; i++) {
+        uint32_t value = esp_efuse_read_reg(EFUSE_BLK3, i);
+        sha2_updateSha256(&ctx, (uint8_t*)&value, sizeof(value));
+    }
+
+    uint32_t keyState[] = {
+        esp_efuse_key_block_unused(keyBlock),
+        esp_efuse_get_key_purpose(keyBlock),
+        esp_efuse_get_key_dis_read(keyBlock)
+    };
+    sha2_updateSha256(&ctx, (uint8_t*)keyState, sizeof(keyState));
+
+    sha2_finalSha256(&ctx, digest);
+}
+
+static int verify(const esp_ds_data_t *data, const uint8_t *pubkeyN,
+  nvs_handle_t nvs, hmac_key_id_t keyId) {
+
+    uint8_t digest[384];
+    memset(digest, 0x42, sizeof(digest));
+    digest[0] = 0xff;
+
+    uint8_t sig[384] = { 0 };
+
+    int ret = esp_ds_sign(digest, data, keyId, sig);
+    if (ret) { return ret; }
+
+    reverseBytes(digest, sizeof(digest));
+    reverseBytes(sig, sizeof(sig));
+
+    // Devices provisioned before pubkey-rr existed compute it once
+    uint8_t rr[384] = { 0 };
+    size_t olen = sizeof(rr);
+    if (nvs_get_blob(nvs, "pubkey-rr", rr, &olen) || olen != sizeof(rr)) {
+        ret = keypair_computeRR(pubkeyN, rr, sizeof(rr));
+        if (ret) { return ret; }
+        nvs_set_blob(nvs, "pubkey-rr", rr, sizeof(rr));
+    }
+
+    uint8_t result[384] = { 0 };
+    ret = keypair_verify(pubkeyN, rr, sig, result, sizeof(result));
+    if (ret) { return ret; }
+
+    return memcmp(result, digest, sizeof(result)) ? -1: 0;
+}
+
+int selftest_run(nvs_handle_t nvs, esp_efuse_block_t keyBlock, hmac_key_id_t keyId,
+  bool *cached) {
+
+    *cached = false;
+
+    // The DS peripheral reads the cipherdata by DMA; this is separate
+    // from the signer, which the REPL may be using concurrently
+    esp_ds_data_t *data = heap_caps_calloc(1, sizeof(esp_ds_data_t), MALLOC_CAP_DMA);
+    if (data == NULL) { return -1; }
+
+    uint8_t pubkeyN[384] = { 0 };
+
+    size_t olen = sizeof(esp_ds_data_t);
+    int ret = nvs_get_blob(nvs, "cipherdata", data, &olen);
+
+    if (ret == 0) {
+        olen = sizeof(pubkeyN);
+        ret = nvs_get_blob(nvs, "pubkey-n", pubkeyN, &olen);
+    }
+
+    if (ret == 0) {
+        uint8_t digest[SHA256_DIGEST_SIZE];
+        computeDigest((uint8_t*)data, pubkeyN, keyBlock, digest);
+
+        uint8_t previous[SHA256_DIGEST_SIZE] = { 0 };
+        olen = sizeof(previous);
+        if (nvs_get_blob(nvs, CACHE_KEY, previous, &olen) == 0 &&
+          olen == sizeof(previous) && memcmp(previous, digest, olen) == 0) {
+            *cached = true;
+
+        } else {
+            ret = verify(data, pubkeyN, nvs, keyId);
+
+            // Only a pass is cached; a failure is always re-tested
+            if (ret == 0) {
+                nvs_set_blob(nvs, CACHE_KEY, digest, sizeof(digest));
+            } else {
+                nvs_erase_key(nvs, CACHE_KEY);
+            }
+        }
+    }
+
+    heap_caps_free(data);
+
+    return ret;
+}
@@ -0,0 +1,30 @@
+#ifndef __SELFTEST_H__
+#define __SELFTEST_H__
+
+#include <stdbool.h>
+
+#include "esp_ds.h"
+#include "esp_efuse.h"
+#include "nvs.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// Checks the DS key (in keyBlock, used as keyId) can sign for the pubkey
+// in NVS. A pass is cached in NVS, keyed by a digest of the cipherdata,
+// pubkey and eFuse state, so an unchanged device does not sign again.
+//
+// Returns 0 if the key verified (cached is set if no signature was
+// needed). This blocks for a full DS signature, so should be run off
+// the boot path.
+int selftest_run(nvs_handle_t nvs, esp_efuse_block_t keyBlock, hmac_key_id_t keyId,
+  bool *cached);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __SELFTEST_H__ */
@@ -0,0 +1,70 @@
+#include <string.h>
+
+#include "session.h"
+
+#include "esp_attr.h"
+#include "esp_system.h"
+
+#include "sha2.h"
+
+
+#define SESSION_MAGIC   (0x50584931)
+
+
+typedef struct RtcSession {
+    uint32_t magic;
+    uint32_t bootCount;
+    SessionState state;
+    uint8_t checksum[SHA256_DIGEST_SIZE];
+} RtcSession;
+
+// Survives a software reset (esp_restart, USB re-enumeration, etc), but
+// is garbage after a power-on reset, which the checksum detects
+static RTC_NOINIT_ATTR RtcSession rtcSession;
+
+
+static void computeChecksum(const RtcSession *session, uint8_t *checksum) {
+    Sha256Context ctx;
+    sha2_initSha256(&ctx);
+    sha2_updateSha256(&ctx, (const uint8_t*)session,
+      sizeof(RtcSession) - sizeof(session->checksum));
+    sha2_finalSha256(&ctx, checksum);
+}
+
+static bool isValid() {
+    if (rtcSession.magic != SESSION_MAGIC) { return false; }
+
+    uint8_t checksum[SHA256_DIGEST_SIZE];
+    computeChecksum(&rtcSession, checksum);
+    return (memcmp(checksum, rtcSession.checksum, sizeof(checksum)) == 0);
+}
+
+int session_restore(SessionState *state) {
+    if (esp_reset_reason() == ESP_RST_POWERON || !isValid()) {
+        session_clear();
+        return 0;
+    }
+
+    rtcSession.bootCount++;
+    if (rtcSession.bootCount > SESSION_MAX_BOOTS) {
+        session_clear();
+        return 0;
+    }
+
+    computeChecksum(&rtcSession, rtcSession.checksum);
+
+    memcpy(state, &rtcSession.state, sizeof(SessionState));
+
+    return rtcSession.bootCount;
+}
+
+void session_save(const SessionState *state) {
+    rtcSession.magic = SESSION_MAGIC;
+    rtcSession.bootCount = 0;
+    memcpy(&rtcSession.state, state, sizeof(SessionState));
+    computeChecksum(&rtcSession, rtcSession.checksum);
+}
+
+void session_clear() {
+    memset(&rtcSession, 0, sizeof(RtcSession));
+}
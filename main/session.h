@@ -0,0 +1,52 @@
+#ifndef __SESSION_H__
+#define __SESSION_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_ds.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// The maximum number of boots a session will be restored across without
+// the state being updated; prevents a reset loop from reviving a stale
+// session forever
+#define SESSION_MAX_BOOTS   (8)
+
+
+// Only non-secret state is persisted; the iv, key and entropy are always
+// regenerated on boot
+typedef struct SessionState {
+    uint32_t modelNumber;
+    uint32_t serialNumber;
+    uint32_t randMarker;
+
+    bool hasPubKey;
+    bool hasCipherdata;
+    bool hasAttest;
+
+    uint8_t pubkeyN[384];
+    uint8_t cipherdata[sizeof(esp_ds_data_t)];
+    uint8_t attest[64];
+} SessionState;
+
+
+// Returns the boot count (1 or higher) if a valid session was restored
+// into state, otherwise 0
+int session_restore(SessionState *state);
+
+// Persists the state to RTC memory, resetting the boot count
+void session_save(const SessionState *state);
+
+// Discards any persisted state
+void session_clear();
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __SESSION_H__ */
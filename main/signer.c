@@ -0,0 +1,60 @@
+#include <string.h>
+
+#include "signer.h"
+
+#include "esp_heap_caps.h"
+
+
+typedef struct Signer {
+    hmac_key_id_t keyId;
+    esp_ds_data_t *data;
+    bool hasCipherdata;
+
+    // Non-null while a signature is in progress
+    esp_ds_context_t *pending;
+} Signer;
+
+static Signer signer = { 0 };
+
+
+int signer_init(hmac_key_id_t keyId) {
+    if (signer.data) { return 0; }
+
+    signer.data = heap_caps_calloc(1, sizeof(esp_ds_data_t), MALLOC_CAP_DMA);
+    if (signer.data == NULL) { return -1; }
+
+    signer.keyId = keyId;
+    signer.hasCipherdata = false;
+
+    return 0;
+}
+
+void signer_setCipherdata(const uint8_t *cipherdata) {
+    if (signer.data == NULL || signer.pending) { return; }
+    memcpy(signer.data, cipherdata, sizeof(esp_ds_data_t));
+    signer.hasCipherdata = true;
+}
+
+bool signer_hasCipherdata() {
+    return signer.hasCipherdata;
+}
+
+int signer_sign(const uint8_t *message, uint8_t *signature) {
+    int ret = signer_start(message);
+    if (ret) { return ret; }
+    return signer_finish(signature);
+}
+
+int signer_start(const uint8_t *message) {
+    if (!signer.hasCipherdata || signer.pending) { return -1; }
+    return esp_ds_start_sign(message, signer.data, signer.keyId, &signer.pending);
+}
+
+int signer_finish(uint8_t *signature) {
+    if (signer.pending == NULL) { return -1; }
+
+    int ret = esp_ds_finish_sign(signature, signer.pending);
+    signer.pending = NULL;
+
+    return ret;
+}
@@ -0,0 +1,41 @@
+#ifndef __SIGNER_H__
+#define __SIGNER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_ds.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+// The DS signing context; owns a single DMA-capable copy of the
+// cipherdata, which is only refreshed when the cipherdata changes
+// (GEN-KEY, SET-CIPHERDATA, LOAD-NVS), rather than on every signature.
+
+int signer_init(hmac_key_id_t keyId);
+
+// Replaces the cipherdata used for signing; cipherdata must be
+// sizeof(esp_ds_data_t) bytes
+void signer_setCipherdata(const uint8_t *cipherdata);
+
+bool signer_hasCipherdata();
+
+// Signs the (little-endian) message, of ESP_DS_SIGNATURE_MAX_BIT_LEN
+// bits, using the DS peripheral
+int signer_sign(const uint8_t *message, uint8_t *signature);
+
+// Starts signing the message in the background; the CPU is free to do
+// other work until signer_finish, which blocks until the DS peripheral
+// is done. The message buffer may be reused once signer_start returns.
+int signer_start(const uint8_t *message);
+int signer_finish(uint8_t *signature);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __SIGNER_H__ */
@@ -35,6 +35,16 @@ void dumpBuffer(char *header, uint8_t *buffer, size_t length) {
     printf(" (%d bytes)\n", length);
 }
 
+// Same as dumpBuffer, without the header or length suffix, so a value
+// can be streamed in parts
+void dumpHex(uint8_t *buffer, size_t length) {
+    static char *hex = "0123456789abcdef";
+
+    for (uint32_t i = 0; i < length; i++) {
+        printf("%c%c", hex[buffer[i] >> 4], hex[buffer[i] & 0x0f]);
+    }
+}
+
 void dumpArray(char *header, uint8_t *buffer, size_t length) {
     static char *hex = "0123456789abcdef";
 
@@ -18,6 +18,7 @@ void delay(uint32_t duration);
 void panic(char *message, int code);
 
 void dumpBuffer(char *header, uint8_t *buffer, size_t length);
+void dumpHex(uint8_t *buffer, size_t length);
 void dumpArray(char *header, uint8_t *buffer, size_t length);
 
 int startsWith(const char* buffer, const char *prefix, size_t length);
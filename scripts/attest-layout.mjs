@@ -0,0 +1,46 @@
+// Generated by scripts/build-layout.mjs from main/attest.h and main/delegate.h; do not edit
+
+export const ATTEST_VERSION = 1;
+export const ATTEST_VERSION_OFFSET = 0;
+export const ATTEST_NONCE_OFFSET = 1;
+export const ATTEST_NONCE_LENGTH = 7;
+export const ATTEST_CHALLENGE_OFFSET = 8;
+export const ATTEST_CHALLENGE_LENGTH = 8;
+export const ATTEST_DEVICE_OFFSET = 16;
+export const ATTEST_MODEL_OFFSET = 16;
+export const ATTEST_SERIAL_OFFSET = 20;
+export const ATTEST_PUBKEYN_OFFSET = 24;
+export const ATTEST_PUBKEYN_LENGTH = 384;
+export const ATTEST_AUTHORITY_OFFSET = 408;
+export const ATTEST_AUTHORITY_LENGTH = 64;
+export const ATTEST_DEVICE_LENGTH = 456;
+export const ATTEST_SIGNATURE_OFFSET = 472;
+export const ATTEST_SIGNATURE_LENGTH = 384;
+export const ATTEST_LENGTH = 856;
+export const ATTEST_COMPACT_VERSION = 3;
+export const ATTEST_COMPACT_KEYID_OFFSET = 24;
+export const ATTEST_COMPACT_KEYID_LENGTH = 32;
+export const ATTEST_COMPACT_SIGNATURE_OFFSET = 56;
+export const ATTEST_COMPACT_LENGTH = 440;
+export const ATTEST_MERKLE_VERSION = 2;
+export const ATTEST_MERKLE_COUNT_OFFSET = 8;
+export const ATTEST_MERKLE_COUNT_LENGTH = 4;
+export const ATTEST_MERKLE_ROOT_OFFSET = 12;
+export const ATTEST_MERKLE_ROOT_LENGTH = 32;
+export const ATTEST_MERKLE_DEVICE_OFFSET = 44;
+export const ATTEST_MERKLE_MODEL_OFFSET = 44;
+export const ATTEST_MERKLE_SERIAL_OFFSET = 48;
+export const ATTEST_MERKLE_PUBKEYN_OFFSET = 52;
+export const ATTEST_MERKLE_AUTHORITY_OFFSET = 436;
+export const ATTEST_MERKLE_SIGNATURE_OFFSET = 500;
+export const ATTEST_MERKLE_LENGTH = 884;
+export const DELEGATE_CERT_VERSION = 4;
+export const DELEGATE_ITEM_VERSION = 5;
+export const DELEGATE_PUBKEY_OFFSET = 8;
+export const DELEGATE_PUBKEY_LENGTH = 65;
+export const DELEGATE_DEVICE_OFFSET = 73;
+export const DELEGATE_CERT_SIGNATURE_OFFSET = 529;
+export const DELEGATE_CERT_LENGTH = 913;
+export const DELEGATE_SIGNATURE_OFFSET = 15;
+export const DELEGATE_SIGNATURE_LENGTH = 64;
+export const DELEGATE_ITEM_LENGTH = 79;
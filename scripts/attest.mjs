@@ -1,8 +1,13 @@
+import { constants, createPublicKey, publicDecrypt, verify as cryptoVerify } from "crypto";
+
 import {
     Signature,
-    getBytes, hexlify, sha256, toBeArray, verifyMessage, zeroPadValue
+    computeHmac, concat, getBytes, hexlify, sha256, toBeArray, toUtf8Bytes,
+    verifyMessage, zeroPadValue
 } from "ethers";
 
+import * as Layout from "./attest-layout.mjs";
+
 
 export const address = "0x70CD34d96E58876a25445dd75f54630D99258182";
 
@@ -24,47 +29,130 @@ export function compute(wallet, model, serial, pubkey) {
     return Signature.from(attest).compactSerialized;
 }
 
-export function verify(_proof) {
-    const proof = getBytes(_proof);
+// Reads a field as hex; see scripts/attest-layout.mjs for the offsets
+function readField(proof, offset, length) {
+    return hexlify(proof.slice(offset, offset + length));
+}
 
-    let offset = 0;
-    const readBytes = function(length) {
-        const result = hexlify(proof.slice(offset, offset + length));
-        offset += length;
-        return result;
-    };
+function checkVersion(proof, version, length) {
+    if (proof[0] !== version) {
+        throw new Error(`invalid attestation; unknown version ${ hexlify(proof.slice(0, 1)) }`);
+    }
+    if (proof.length !== length) {
+        throw new Error(`invalid attestation; bad length ${ proof.length }`);
+    }
+}
 
-    const version = readBytes(1);
-    const nonceRand = readBytes(7);
-    const nonce = readBytes(8);
-    const model = readBytes(4);
-    const serial = readBytes(4);
-    const pubkeyN = readBytes(384);
-    const attestation = readBytes(64);
-    const sig = readBytes(384);
+// Caches for repeat devices; the recovered authority for each device
+// block, and the parsed modulus for each pubkey
+const CacheSize = 4096;
+const authorityCache = new Map();
+const modulusCache = new Map();
 
-    // Check the version is supported
-    if (version !== "0x01") {
-        throw new Error(`invalid attestation; unknown version ${ version }`);
+function cacheSet(cache, key, value) {
+    if (cache.size >= CacheSize) { cache.clear(); }
+    cache.set(key, value);
+}
+
+// Check the attestation is correct for the model and serial
+function verifyAuthority(model, serial, pubkeyN, attestation) {
+    const key = `${ model }:${ serial }:${ pubkeyN }:${ attestation }`;
+
+    let recovered = authorityCache.get(key);
+    if (recovered == null) {
+        const message = getMessage(model, serial, pubkeyN);
+        recovered = verifyMessage(message, attestation);
+        cacheSet(authorityCache, key, recovered);
     }
 
-    // Check the attestation is correct for the model and serial
-    const message = getMessage(model, serial, pubkeyN);
-    const recovered = verifyMessage(message, attestation);
     if (address !== recovered) {
         throw new Error(`invalid attestation; address not signing authority (${ recovered } != ${ address })`);
     }
+}
+
+function base64Url(hex) {
+    return Buffer.from(hex.substring(2), "hex").toString("base64url");
+}
 
+function getModulus(pubkeyN) {
+    let modulus = modulusCache.get(pubkeyN);
+    if (modulus == null) {
+        modulus = { n: BigInt(pubkeyN), key: null };
+
+        // OpenSSL rejects some moduli (e.g. even); those use BigInt
+        try {
+            modulus.key = createPublicKey({
+                format: "jwk",
+                key: { kty: "RSA", n: base64Url(pubkeyN), e: "AQAB" }
+            });
+        } catch (error) { }
+
+        cacheSet(modulusCache, pubkeyN, modulus);
+    }
+    return modulus;
+}
+
+// Computes (sig ** 65537) % n, as 16 modular squarings and a multiply,
+// rather than materializing sig ** 65537 (~200 million bits) first
+function powE(sig, n) {
+    let result = sig % n;
+    for (let i = 0; i < 16; i++) { result = (result * result) % n; }
+    return (result * sig) % n;
+}
+
+// Computes (sig ** 65537) % n for a 384-byte sig, or null if the sig
+// is not reduced (which is never a valid signature); bulk verification
+// should use the native verifier (see scripts/script-verify.mjs)
+function rsaPublic(sig, pubkeyN) {
+    const { n, key } = getModulus(pubkeyN);
+
+    if (key == null) {
+        const s = BigInt(sig);
+        if (s >= n) { return null; }
+        return powE(s, n);
+    }
+
+    try {
+        const result = publicDecrypt({
+            key, padding: constants.RSA_NO_PADDING
+        }, Buffer.from(sig.substring(2), "hex"));
+        return BigInt("0x" + result.toString("hex"));
+    } catch (error) {
+        // OpenSSL rejects sig >= n
+        return null;
+    }
+}
+
+// Check the RSA signature covers the proof (excluding the signature)
+function verifySignature(proof, pubkeyN, sig) {
     // Compute the RSA challenge hash
-    const challenge = proof.slice(0, proof.length - 384);
+    const challenge = proof.slice(0, proof.length - Layout.ATTEST_SIGNATURE_LENGTH);
     const hash = sha256(challenge);
 
     // Check the RSA maths are correct
     // See: https://cryptobook.nakov.com/digital-signatures/rsa-sign-verify-examples
-    const verify = ((BigInt(sig) ** E) % BigInt(pubkeyN));
+    const verify = rsaPublic(sig, pubkeyN);
     if (BigInt(hash) !== verify) {
         throw new Error("invalid attestion; signature did not match");
     }
+}
+
+// The version 1 layout is defined in main/attest.h
+export function verify(_proof) {
+    const proof = getBytes(_proof);
+
+    // Check the version is supported
+    checkVersion(proof, Layout.ATTEST_VERSION, Layout.ATTEST_LENGTH);
+
+    const nonce = readField(proof, Layout.ATTEST_CHALLENGE_OFFSET, Layout.ATTEST_CHALLENGE_LENGTH);
+    const model = readField(proof, Layout.ATTEST_MODEL_OFFSET, 4);
+    const serial = readField(proof, Layout.ATTEST_SERIAL_OFFSET, 4);
+    const pubkeyN = readField(proof, Layout.ATTEST_PUBKEYN_OFFSET, Layout.ATTEST_PUBKEYN_LENGTH);
+    const attestation = readField(proof, Layout.ATTEST_AUTHORITY_OFFSET, Layout.ATTEST_AUTHORITY_LENGTH);
+    const sig = readField(proof, Layout.ATTEST_SIGNATURE_OFFSET, Layout.ATTEST_SIGNATURE_LENGTH);
+
+    verifyAuthority(model, serial, pubkeyN, attestation);
+    verifySignature(proof, pubkeyN, sig);
 
     return {
         authority: address,
@@ -75,7 +163,255 @@ export function verify(_proof) {
     };
 }
 
-const E = BigInt(65537);
+// Resolves the key ID in compact (version 3) proofs; each device must
+// be registered from a full proof (version 1) first, which verifies its
+// authority once
+export class Registry {
+    constructor() {
+        this._devices = new Map();
+    }
+
+    get size() { return this._devices.size; }
+
+    // Returns the key ID
+    register(_proof) {
+        const proof = getBytes(_proof);
+        verify(proof);
+
+        const model = readField(proof, Layout.ATTEST_MODEL_OFFSET, 4);
+        const serial = readField(proof, Layout.ATTEST_SERIAL_OFFSET, 4);
+        const pubkeyN = readField(proof, Layout.ATTEST_PUBKEYN_OFFSET, Layout.ATTEST_PUBKEYN_LENGTH);
+
+        const keyId = sha256(pubkeyN);
+        this._devices.set(keyId, { model, serial, pubkeyN });
+
+        return keyId;
+    }
+
+    get(keyId) {
+        return this._devices.get(hexlify(keyId)) || null;
+    }
+}
+
+// The version 3 layout is defined in main/attest.h
+export function verifyCompact(_proof, registry) {
+    const proof = getBytes(_proof);
+
+    checkVersion(proof, Layout.ATTEST_COMPACT_VERSION, Layout.ATTEST_COMPACT_LENGTH);
+
+    const nonce = readField(proof, Layout.ATTEST_CHALLENGE_OFFSET, Layout.ATTEST_CHALLENGE_LENGTH);
+    const model = readField(proof, Layout.ATTEST_MODEL_OFFSET, 4);
+    const serial = readField(proof, Layout.ATTEST_SERIAL_OFFSET, 4);
+    const keyId = readField(proof, Layout.ATTEST_COMPACT_KEYID_OFFSET, Layout.ATTEST_COMPACT_KEYID_LENGTH);
+    const sig = readField(proof, Layout.ATTEST_COMPACT_SIGNATURE_OFFSET, Layout.ATTEST_SIGNATURE_LENGTH);
+
+    const device = registry.get(keyId);
+    if (device == null) {
+        throw new Error(`invalid attestation; unknown key ID ${ keyId } (register a full proof)`);
+    }
+
+    // The authority only attested this key for one model and serial
+    if (device.model !== model || device.serial !== serial) {
+        throw new Error("invalid attestation; model or serial does not match key");
+    }
+
+    verifySignature(proof, device.pubkeyN, sig);
+
+    return {
+        authority: address,
+        model: parseInt(model),
+        modelName: getModel(model),
+        serial: parseInt(serial),
+        keyId,
+        nonce
+    };
+}
+
+// Verified session certificates, by certificate hash
+const delegationCache = new Map();
+
+// Verifies an ATTEST-SESSION certificate (version 4), which delegates
+// to a per-boot P-256 session key; the layout is defined in
+// main/delegate.h
+export function verifyDelegation(_cert) {
+    const cert = getBytes(_cert);
+    const certId = sha256(cert);
+
+    let delegation = delegationCache.get(certId);
+    if (delegation) { return delegation; }
+
+    checkVersion(cert, Layout.DELEGATE_CERT_VERSION, Layout.DELEGATE_CERT_LENGTH);
+
+    // The device block is at the same offsets (relative to its start) as
+    // in version 1
+    const device = Layout.DELEGATE_DEVICE_OFFSET - Layout.ATTEST_DEVICE_OFFSET;
+
+    const pubkey = readField(cert, Layout.DELEGATE_PUBKEY_OFFSET, Layout.DELEGATE_PUBKEY_LENGTH);
+    const model = readField(cert, device + Layout.ATTEST_MODEL_OFFSET, 4);
+    const serial = readField(cert, device + Layout.ATTEST_SERIAL_OFFSET, 4);
+    const pubkeyN = readField(cert, device + Layout.ATTEST_PUBKEYN_OFFSET, Layout.ATTEST_PUBKEYN_LENGTH);
+    const attestation = readField(cert, device + Layout.ATTEST_AUTHORITY_OFFSET, Layout.ATTEST_AUTHORITY_LENGTH);
+    const sig = readField(cert, Layout.DELEGATE_CERT_SIGNATURE_OFFSET, Layout.ATTEST_SIGNATURE_LENGTH);
+
+    verifyAuthority(model, serial, pubkeyN, attestation);
+    verifySignature(cert, pubkeyN, sig);
+
+    const point = getBytes(pubkey);
+    if (point[0] !== 0x04) {
+        throw new Error("invalid attestation; session key not uncompressed");
+    }
+
+    const key = createPublicKey({
+        format: "jwk",
+        key: {
+            kty: "EC", crv: "P-256",
+            x: Buffer.from(point.slice(1, 33)).toString("base64url"),
+            y: Buffer.from(point.slice(33, 65)).toString("base64url")
+        }
+    });
+
+    delegation = {
+        authority: address,
+        model: parseInt(model),
+        modelName: getModel(model),
+        serial: parseInt(serial),
+        certId, pubkey, key
+    };
+    cacheSet(delegationCache, certId, delegation);
+
+    return delegation;
+}
+
+// Verifies an ATTEST-SESSION item against its certificate; the
+// certificate is only fully checked the first time it is seen
+export function verifySession(cert, _item) {
+    const { authority, model, modelName, serial, certId, key } = verifyDelegation(cert);
+
+    const item = getBytes(_item);
+    if (item.length !== Layout.DELEGATE_ITEM_LENGTH) {
+        throw new Error(`invalid attestation; bad session item length ${ item.length }`);
+    }
+
+    const nonce = readField(item, Layout.ATTEST_NONCE_LENGTH, Layout.ATTEST_CHALLENGE_LENGTH);
+    const sig = item.slice(Layout.DELEGATE_SIGNATURE_OFFSET,
+      Layout.DELEGATE_SIGNATURE_OFFSET + Layout.DELEGATE_SIGNATURE_LENGTH);
+
+    const version = hexlify(new Uint8Array([ Layout.DELEGATE_ITEM_VERSION ]));
+    const message = concat([ version, item.slice(0, Layout.DELEGATE_SIGNATURE_OFFSET) ]);
+    const valid = cryptoVerify("sha256", getBytes(message), {
+        key, dsaEncoding: "ieee-p1363"
+    }, sig);
+
+    if (!valid) {
+        throw new Error("invalid attestation; session signature did not match");
+    }
+
+    return { authority, model, modelName, serial, certId, nonce };
+}
+
+// The CHALLENGE-HMAC key for a device, derived from a provisioning
+// secret (see script-provision.mjs), so per-device keys are never stored
+// and can be recomputed by anyone holding the secret
+export function deriveHmacKey(secret, model, serial) {
+    const message = concat([
+        toUtf8Bytes("pixie-hmac-key"), "0x" + toHex(model, 4), "0x" + toHex(serial, 4)
+    ]);
+    return computeHmac("sha256", secret, message);
+}
+
+// Verifies a CHALLENGE-HMAC response, using the key registered with
+// SET-HMAC-KEY during provisioning; this only proves liveness of a
+// known device, so use ATTEST for anything which needs a real proof
+export function verifyHmac(hmacKey, model, serial, _nonce, mac) {
+    const nonce = getBytes(_nonce);
+    if (nonce.length !== 16) {
+        throw new Error(`invalid challenge; nonce must be 16 bytes`);
+    }
+
+    const message = concat([ "0x" + toHex(model, 4), "0x" + toHex(serial, 4), nonce ]);
+    if (computeHmac("sha256", hmacKey, message) !== hexlify(mac)) {
+        throw new Error("invalid challenge; hmac did not match");
+    }
+}
+
+// Verifies an ATTEST-MERKLE proof, which signs the root of a tree over
+// many challenges, and that the challenge (at index) is included by
+// its path (the attest.path.INDEX value)
+export function verifyMerkle(_proof, _challenge, index, _path) {
+    const proof = getBytes(_proof);
+    checkVersion(proof, Layout.ATTEST_MERKLE_VERSION, Layout.ATTEST_MERKLE_LENGTH);
+
+    const count = parseInt(readField(proof, Layout.ATTEST_MERKLE_COUNT_OFFSET, Layout.ATTEST_MERKLE_COUNT_LENGTH));
+    const root = readField(proof, Layout.ATTEST_MERKLE_ROOT_OFFSET, Layout.ATTEST_MERKLE_ROOT_LENGTH);
+    const model = readField(proof, Layout.ATTEST_MERKLE_MODEL_OFFSET, 4);
+    const serial = readField(proof, Layout.ATTEST_MERKLE_SERIAL_OFFSET, 4);
+    const pubkeyN = readField(proof, Layout.ATTEST_MERKLE_PUBKEYN_OFFSET, Layout.ATTEST_PUBKEYN_LENGTH);
+    const attestation = readField(proof, Layout.ATTEST_MERKLE_AUTHORITY_OFFSET, Layout.ATTEST_AUTHORITY_LENGTH);
+    const sig = readField(proof, Layout.ATTEST_MERKLE_SIGNATURE_OFFSET, Layout.ATTEST_SIGNATURE_LENGTH);
+
+    const challenge = getBytes(_challenge);
+    if (challenge.length !== Layout.ATTEST_CHALLENGE_LENGTH) {
+        throw new Error(`invalid challenge; bad length ${ challenge.length }`);
+    }
+
+    if (index < 0 || index >= count) {
+        throw new Error(`invalid attestation; index out of range (${ index })`);
+    }
+
+    verifyAuthority(model, serial, pubkeyN, attestation);
+    verifySignature(proof, pubkeyN, sig);
+
+    // Walk the path from the leaf to the root; a node without a sibling
+    // is promoted to the next level unchanged
+    const path = getBytes(_path);
+    let node = sha256(concat([ "0x00", challenge ]));
+    let offset = 0;
+    for (let width = count; width > 1; width = (width + 1) >> 1) {
+        if ((index ^ 1) < width) {
+            const sibling = path.slice(offset, offset + 32);
+            if (sibling.length !== 32) {
+                throw new Error("invalid attestation; path too short");
+            }
+            offset += 32;
+
+            node = sha256(concat((index & 1) ? [ "0x01", sibling, node ]: [ "0x01", node, sibling ]));
+        }
+        index >>= 1;
+    }
+
+    if (offset !== path.length) {
+        throw new Error("invalid attestation; path too long");
+    }
+
+    if (node !== root) {
+        throw new Error("invalid attestation; challenge not included in root");
+    }
+
+    return {
+        authority: address,
+        model: parseInt(model),
+        modelName: getModel(model),
+        serial: parseInt(serial),
+        root
+    };
+}
+
+// Expands the result of an ATTEST-N into the equivalent ATTEST proofs,
+// each of which can be passed to verify
+export function expandBatch(result) {
+    const device = getBytes(result["attest.device"]);
+
+    const proofs = [ ];
+    for (let i = 0; i < result["attest.count"]; i++) {
+        const item = getBytes(result[`attest.${ i }`]);
+        const split = Layout.ATTEST_DEVICE_OFFSET - Layout.ATTEST_NONCE_OFFSET;
+        proofs.push(concat([
+            "0x01", item.slice(0, split), device, item.slice(split)
+        ]));
+    }
+
+    return proofs;
+}
 
 function toHex(v, length) {
     if (typeof(v) === "number") { v = hexlify(toBeArray(v)); }
@@ -0,0 +1,35 @@
+import { dirname, join } from "path";
+import { fileURLToPath } from "url";
+
+import { encodeImage, readPng, writeHeader } from "./image.mjs";
+
+// Converts a PNG into a compressed image header (see main/image.h)
+//
+// Usage: node build-image.mjs INPUT_PNG NAME
+//   e.g. node build-image.mjs assets/logo.png logo
+
+(async function() {
+    const [ input, name ] = process.argv.slice(2);
+    if (!input || !name || !name.match(/^[a-z0-9_]+$/)) {
+        throw new Error("usage: build-image.mjs INPUT_PNG NAME");
+    }
+
+    const image = readPng(input);
+    const words = encodeImage(image);
+
+    const root = join(dirname(fileURLToPath(import.meta.url)), "..");
+    const output = join(root, "main", `image-${ name }.h`);
+    writeHeader(output, name, words);
+
+    console.log({
+        output,
+        width: image.width,
+        height: image.height,
+        raw: (3 + image.width * image.height) * 2,
+        compressed: words.length * 2
+    });
+
+})().catch((error) => {
+    console.log({ error });
+    process.exitCode = 1;
+});
@@ -0,0 +1,71 @@
+import fs from "fs";
+import { dirname, join } from "path";
+import { fileURLToPath } from "url";
+
+// Generates scripts/attest-layout.mjs from the layout defines in
+// main/attest.h and main/delegate.h, so the verifiers parse proofs with
+// exactly the offsets the firmware writes them at.
+//
+// Re-run this whenever those headers change; with --check, it only
+// fails if the generated file is out of date.
+//
+// Usage: node build-layout.mjs [ --check ]
+
+const root = join(dirname(fileURLToPath(import.meta.url)), "..");
+
+const Headers = [ "main/attest.h", "main/delegate.h" ];
+
+function readDefines(filename, values) {
+    const source = fs.readFileSync(join(root, filename)).toString();
+
+    for (const line of source.split("\n")) {
+        const match = line.match(/^#define\s+((ATTEST|DELEGATE)_[A-Z0-9_]+)\s+\((.*)\)\s*$/);
+        if (!match) { continue; }
+
+        const [ , name, , expr ] = match;
+
+        // Only integer literals and earlier defines may appear
+        const js = expr.replace(/[A-Z][A-Z0-9_]*/g, (ref) => {
+            if (!(ref in values)) { throw new Error(`${ filename }: ${ name } uses unknown ${ ref }`); }
+            return String(values[ref]);
+        });
+        if (!js.match(/^[0-9a-fx+\-*() ]*$/i)) {
+            throw new Error(`${ filename }: unsupported expression for ${ name }: ${ expr }`);
+        }
+
+        values[name] = (new Function(`return (${ js });`))();
+    }
+}
+
+function generate() {
+    const values = { };
+    Headers.forEach((filename) => readDefines(filename, values));
+
+    const lines = Object.keys(values).map((name) => {
+        return `export const ${ name } = ${ values[name] };`;
+    });
+
+    return `// Generated by scripts/build-layout.mjs from ${ Headers.join(" and ") }; do not edit
+
+${ lines.join("\n") }
+`;
+}
+
+(async function() {
+    const output = join(root, "scripts/attest-layout.mjs");
+    const content = generate();
+
+    if (process.argv[2] === "--check") {
+        const current = fs.existsSync(output) ? fs.readFileSync(output).toString(): "";
+        if (current !== content) {
+            throw new Error("scripts/attest-layout.mjs is out of date; run: node scripts/build-layout.mjs");
+        }
+        return;
+    }
+
+    fs.writeFileSync(output, content);
+
+})().catch((error) => {
+    console.log({ error });
+    process.exitCode = 1;
+});
@@ -0,0 +1,159 @@
+import fs from "fs";
+import zlib from "zlib";
+
+// The compressed image format decoded by main/image.c; all values are
+// uint16 words:
+//
+//   format, width, height
+//   row index; height uint32 offsets (low word first) into the data
+//   data; each row is a sequence of tokens, which never cross a row:
+//     - 0x8000 | n, color       a run of n pixels of color
+//     - n, color * n            n literal pixels
+//
+// Pixels are byte-swapped RGB565, as the display expects.
+
+export const FORMAT_RLE = 0x0201;
+
+const MAX_COUNT = 0x7fff;
+
+// Decodes an 8-bit RGB or RGBA, non-interlaced PNG into RGB565 pixels
+export function readPng(filename) {
+    const data = fs.readFileSync(filename);
+
+    let width = 0, height = 0, colorType = -1;
+    const idat = [ ];
+    for (let offset = 8; offset < data.length;) {
+        const length = data.readUInt32BE(offset);
+        const type = data.toString("ascii", offset + 4, offset + 8);
+        const chunk = data.subarray(offset + 8, offset + 8 + length);
+
+        if (type === "IHDR") {
+            width = chunk.readUInt32BE(0);
+            height = chunk.readUInt32BE(4);
+            if (chunk[8] !== 8 || chunk[12] !== 0) {
+                throw new Error(`unsupported png: ${ filename }`);
+            }
+            colorType = chunk[9];
+        } else if (type === "IDAT") {
+            idat.push(chunk);
+        }
+
+        offset += 12 + length;
+    }
+
+    const bpp = { 2: 3, 6: 4 }[colorType];
+    if (!bpp) { throw new Error(`unsupported png color type: ${ colorType }`); }
+
+    // Undo the per-row filters
+    const raw = zlib.inflateSync(Buffer.concat(idat));
+    const stride = width * bpp;
+    const rgb = new Uint8Array(height * stride);
+    for (let y = 0; y < height; y++) {
+        const filter = raw[y * (stride + 1)];
+        for (let x = 0; x < stride; x++) {
+            const value = raw[y * (stride + 1) + 1 + x];
+            const a = (x >= bpp) ? rgb[y * stride + x - bpp]: 0;
+            const b = y ? rgb[(y - 1) * stride + x]: 0;
+            const c = (x >= bpp && y) ? rgb[(y - 1) * stride + x - bpp]: 0;
+
+            let predict = 0;
+            if (filter === 1) {
+                predict = a;
+            } else if (filter === 2) {
+                predict = b;
+            } else if (filter === 3) {
+                predict = (a + b) >> 1;
+            } else if (filter === 4) {
+                const pa = Math.abs(b - c), pb = Math.abs(a - c), pc = Math.abs(a + b - 2 * c);
+                predict = (pa <= pb && pa <= pc) ? a: ((pb <= pc) ? b: c);
+            }
+
+            rgb[y * stride + x] = (value + predict) & 0xff;
+        }
+    }
+
+    const pixels = new Uint16Array(width * height);
+    for (let i = 0; i < pixels.length; i++) {
+        const r = rgb[i * bpp], g = rgb[i * bpp + 1], b = rgb[i * bpp + 2];
+        const color = (Math.round(r * 31 / 255) << 11) |
+          (Math.round(g * 63 / 255) << 5) | Math.round(b * 31 / 255);
+        pixels[i] = ((color & 0xff) << 8) | (color >> 8);
+    }
+
+    return { width, height, pixels };
+}
+
+function encodeRow(row) {
+    const tokens = [ ];
+
+    let literal = [ ];
+    const flush = () => {
+        if (literal.length) { tokens.push(literal.length, ...literal); }
+        literal = [ ];
+    };
+
+    for (let x = 0; x < row.length;) {
+        let run = 1;
+        while (x + run < row.length && run < MAX_COUNT && row[x + run] === row[x]) { run++; }
+
+        // A run of 2 only saves a word if it does not split a literal
+        if (run >= 3 || (run === 2 && literal.length === 0)) {
+            flush();
+            tokens.push(0x8000 | run, row[x]);
+            x += run;
+        } else {
+            literal.push(row[x++]);
+            if (literal.length === MAX_COUNT) { flush(); }
+        }
+    }
+    flush();
+
+    return tokens;
+}
+
+export function encodeImage({ width, height, pixels }) {
+    const index = [ ], data = [ ];
+    for (let y = 0; y < height; y++) {
+        index.push(data.length & 0xffff, data.length >>> 16);
+        data.push(...encodeRow(pixels.subarray(y * width, (y + 1) * width)));
+    }
+    return [ FORMAT_RLE, width, height, ...index, ...data ];
+}
+
+// Writes the encoded image as a C header, defining image_NAME
+export function writeHeader(filename, name, words, defines) {
+    const guard = `__IMAGE_${ name.toUpperCase() }_H__`;
+
+    const lines = [ ];
+    for (let i = 0; i < words.length; i += 8) {
+        lines.push("  " + words.slice(i, i + 8).map((v) => {
+            return "0x" + v.toString(16).padStart(4, "0");
+        }).join(", ") + ",");
+    }
+
+    const extra = Object.keys(defines || { }).map((key) => {
+        return `#define ${ key.padEnd(20) }(${ defines[key] })\n`;
+    }).join("");
+
+    fs.writeFileSync(filename, `#ifndef ${ guard }
+#define ${ guard }
+
+// Generated by scripts/image.mjs; do not edit
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+#include <stdint.h>
+
+${ extra ? (extra + "\n"): "" }// See main/image.h for the format
+const uint16_t image_${ name }[] = {
+${ lines.join("\n") }
+};
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* ${ guard } */
+`);
+}
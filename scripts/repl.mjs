@@ -6,6 +6,7 @@ import { DeviceEsp32c3 } from "../../firefly-js/lib.esm/device-esp32c3.js";
 import { stall } from "./utils.mjs";
 
 const NumericCommands = [
+    "PERSIST",
     "SET-MODEL",
     "SET-SERIAL",
 ];
@@ -13,6 +14,7 @@ const NumericCommands = [
 const DataCommands = [
     "SET-ATTEST",
     "SET-CIPHERDATA",
+    "SET-HMAC-KEY",
     "SET-PUBKEYN",
     "STIR-ENTROPY",
     "STIR-IV",
@@ -47,7 +49,8 @@ export class FireflyRepl {
         let count = 0;
         while (true) {
             const line = await this._device.readLine();
-            if (line === "<READY") { break; }
+            // The first READY after boot includes boot timings
+            if (line.match(/^<READY( |$)/)) { break; }
             await stall(100);
             if (count++ > 10) {
                 await this._sendCommand("PING");
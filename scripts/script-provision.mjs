@@ -11,11 +11,15 @@ import {
 
 import { Log } from "./log.mjs";
 import { FireflyRepl } from "./repl.mjs";
-import { compute, verify } from "./attest.mjs";
+import { compute, deriveHmacKey, verify, verifyHmac } from "./attest.mjs";
 
 
 const FOLDER = "/Volumes/FireflyProvision";
 
+// The CHALLENGE-HMAC keys are derived from the key at this path of the
+// provisioning mnemonic; only the path is logged
+const HMAC_PATH = "m/44'/60'/1'/0/0";
+
 function readCred(filename) {
     return fs.readFileSync(join(FOLDER, "creds", filename)).toString().trim();
 }
@@ -41,6 +45,8 @@ function readCred(filename) {
         throw new Error(`incorrect password: ${ address } (derivced ${ wallet.address }`);
     }
 
+    const hmacSecret = HDNodeWallet.fromMnemonic(mnemonic, HMAC_PATH).privateKey;
+
 
     while (true) {
         const log = Log.getNextLog(model);
@@ -69,13 +75,16 @@ function readCred(filename) {
                 throw new Error(`unsupported version: ${ version }`);
             }
 
+            // Stir the entropy first, so the device can begin searching
+            // for primes while the rest of the session is configured
+            await repl.sendCommand(`STIR-ENTROPY=${ hexlify(randomBytes(32)) }`);
+
             await repl.sendCommand(`SET-MODEL=${ model }`);
             await repl.sendCommand(`SET-SERIAL=${ serial }`);
 
             const dump = await repl.sendCommand(`DUMP`);
             log.log({ dump });
 
-            await repl.sendCommand(`STIR-ENTROPY=${ hexlify(randomBytes(32)) }`);
             await repl.sendCommand(`STIR-IV=${ hexlify(randomBytes(32)) }`);
             await repl.sendCommand(`STIR-KEY=${ hexlify(randomBytes(32)) }`);
 
@@ -92,6 +101,11 @@ function readCred(filename) {
 
             log.log({ write: await repl.sendCommand(`WRITE`) });
 
+            // Register a key for fast CHALLENGE-HMAC liveness checks
+            const hmacKey = deriveHmacKey(hmacSecret, model, serial);
+            log.set("hmacKeyPath", HMAC_PATH);
+            await repl.sendCommand(`SET-HMAC-KEY=${ hmacKey }`);
+
             log.log({ burn: await repl.sendCommand(`BURN`) });
 
             log.log({ dump: await repl.sendCommand(`DUMP`) });
@@ -100,6 +114,11 @@ function readCred(filename) {
             console.log({ proof });
             console.log(verify(proof.attest));
 
+            const nonce = hexlify(randomBytes(16));
+            const { hmac } = await repl.sendCommand(`CHALLENGE-HMAC=${ nonce.substring(2) }`);
+            verifyHmac(hmacKey, model, serial, nonce, hmac);
+            console.log({ hmac });
+
             await repl.sendCommand(`RESET`);
 
         } catch (error) {
@@ -0,0 +1,23 @@
+import { spawnSync } from "child_process";
+import fs from "fs";
+import { fileURLToPath } from "url";
+
+// Verifies a file of ATTEST proofs (one hex proof per line) across all
+// cores, using the native verifier (see host/verify); build it first:
+//
+//   cmake -S host -B host/build && cmake --build host/build
+//
+// Usage: node script-verify.mjs PROOFS_FILE [ THREADS ]
+//
+// Set PIXIE_VERIFY to use a pixie-verify binary from another build.
+
+const binary = process.env.PIXIE_VERIFY ||
+  fileURLToPath(new URL("../host/build/pixie-verify", import.meta.url));
+
+if (!fs.existsSync(binary)) {
+    console.log(`missing ${ binary }; build host/ first`);
+    process.exit(1);
+}
+
+const result = spawnSync(binary, process.argv.slice(2), { stdio: "inherit" });
+process.exitCode = (result.status == null) ? 1: result.status;